@@ -634,6 +634,16 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_THREAD_LOGGING_FLAG "thread_logging_flag"
 
+#define PRM_NAME_OPTIMIZER_AUTO_INDEX_SCAN_OID_ORDER "optimizer_auto_index_scan_oid_order"
+
+#define PRM_NAME_HF_OVF_COMPRESS_THRESHOLD "heap_overflow_compress_threshold"
+
+#define PRM_NAME_MAX_SUBQUERY_HASH_SIZE "max_subquery_hash_size"
+
+#define PRM_NAME_MAX_SUBQUERY_CACHE_SIZE "max_subquery_cache_size"
+
+#define PRM_NAME_MAX_JOIN_FILTER_SIZE "max_join_filter_size"
+
 #define PRM_VALUE_DEFAULT "DEFAULT"
 #define PRM_VALUE_MAX "MAX"
 #define PRM_VALUE_MIN "MIN"
@@ -2096,6 +2106,34 @@ int PRM_THREAD_LOGGING_FLAG = 0;
 static int prm_thread_logging_flag_default = 0;
 static unsigned int prm_thread_logging_flag_flag = 0;
 
+bool PRM_OPTIMIZER_AUTO_INDEX_SCAN_OID_ORDER = false;
+static bool prm_optimizer_auto_index_scan_oid_order_default = false;
+static unsigned int prm_optimizer_auto_index_scan_oid_order_flag = 0;
+
+int PRM_HF_OVF_COMPRESS_THRESHOLD = 0;
+static int prm_hf_ovf_compress_threshold_default = 0;
+static int prm_hf_ovf_compress_threshold_upper = INT_MAX;
+static int prm_hf_ovf_compress_threshold_lower = 0;
+static unsigned int prm_hf_ovf_compress_threshold_flag = 0;
+
+int PRM_MAX_SUBQUERY_HASH_SIZE = 8 * 1024 * 1024;
+static int prm_max_subquery_hash_size_default = 8 * 1024 * 1024;
+static int prm_max_subquery_hash_size_upper = 128 * 1024 * 1024;
+static int prm_max_subquery_hash_size_lower = 0;
+static unsigned int prm_max_subquery_hash_size_flag = 0;
+
+int PRM_MAX_SUBQUERY_CACHE_SIZE = 2 * 1024 * 1024;
+static int prm_max_subquery_cache_size_default = 2 * 1024 * 1024;
+static int prm_max_subquery_cache_size_upper = 128 * 1024 * 1024;
+static int prm_max_subquery_cache_size_lower = 0;
+static unsigned int prm_max_subquery_cache_size_flag = 0;
+
+int PRM_MAX_JOIN_FILTER_SIZE = 1 * 1024 * 1024;
+static int prm_max_join_filter_size_default = 1 * 1024 * 1024;
+static int prm_max_join_filter_size_upper = 64 * 1024 * 1024;
+static int prm_max_join_filter_size_lower = 0;
+static unsigned int prm_max_join_filter_size_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -5338,6 +5376,61 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_OPTIMIZER_AUTO_INDEX_SCAN_OID_ORDER,
+   PRM_NAME_OPTIMIZER_AUTO_INDEX_SCAN_OID_ORDER,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE | PRM_FOR_SESSION | PRM_FOR_QRY_STRING),
+   PRM_BOOLEAN,
+   &prm_optimizer_auto_index_scan_oid_order_flag,
+   (void *) &prm_optimizer_auto_index_scan_oid_order_default,
+   (void *) &PRM_OPTIMIZER_AUTO_INDEX_SCAN_OID_ORDER,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HF_OVF_COMPRESS_THRESHOLD,
+   PRM_NAME_HF_OVF_COMPRESS_THRESHOLD,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_hf_ovf_compress_threshold_flag,
+   (void *) &prm_hf_ovf_compress_threshold_default,
+   (void *) &PRM_HF_OVF_COMPRESS_THRESHOLD,
+   (void *) &prm_hf_ovf_compress_threshold_upper, (void *) &prm_hf_ovf_compress_threshold_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_SUBQUERY_HASH_SIZE,
+   PRM_NAME_MAX_SUBQUERY_HASH_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_SIZE_UNIT),
+   PRM_INTEGER,
+   &prm_max_subquery_hash_size_flag,
+   (void *) &prm_max_subquery_hash_size_default,
+   (void *) &PRM_MAX_SUBQUERY_HASH_SIZE,
+   (void *) &prm_max_subquery_hash_size_upper, (void *) &prm_max_subquery_hash_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_SUBQUERY_CACHE_SIZE,
+   PRM_NAME_MAX_SUBQUERY_CACHE_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_SIZE_UNIT),
+   PRM_INTEGER,
+   &prm_max_subquery_cache_size_flag,
+   (void *) &prm_max_subquery_cache_size_default,
+   (void *) &PRM_MAX_SUBQUERY_CACHE_SIZE,
+   (void *) &prm_max_subquery_cache_size_upper, (void *) &prm_max_subquery_cache_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_JOIN_FILTER_SIZE,
+   PRM_NAME_MAX_JOIN_FILTER_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_SIZE_UNIT),
+   PRM_INTEGER,
+   &prm_max_join_filter_size_flag,
+   (void *) &prm_max_join_filter_size_default,
+   (void *) &PRM_MAX_JOIN_FILTER_SIZE,
+   (void *) &prm_max_join_filter_size_upper, (void *) &prm_max_join_filter_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
 };
 
 #define NUM_PRM ((int)(sizeof(prm_Def)/sizeof(prm_Def[0])))
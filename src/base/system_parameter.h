@@ -407,8 +407,18 @@ enum param_id
 
   PRM_ID_THREAD_LOGGING_FLAG,
 
+  PRM_ID_OPTIMIZER_AUTO_INDEX_SCAN_OID_ORDER,
+
+  PRM_ID_HF_OVF_COMPRESS_THRESHOLD,
+
+  PRM_ID_MAX_SUBQUERY_HASH_SIZE,
+
+  PRM_ID_MAX_SUBQUERY_CACHE_SIZE,
+
+  PRM_ID_MAX_JOIN_FILTER_SIZE,
+
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_THREAD_LOGGING_FLAG
+  PRM_LAST_ID = PRM_ID_MAX_JOIN_FILTER_SIZE
 };
 typedef enum param_id PARAM_ID;
 
@@ -2606,6 +2606,47 @@ qo_plan_multi_range_opt (QO_PLAN * plan)
   return false;
 }
 
+/*
+ * qo_plan_iscan_oid_order () - check if index scan should fetch objects in OID order
+ *   return: true/false
+ *   plan(in): QO_PLAN
+ *
+ * Note: Only plans that do not rely on index key order are considered. Query executor still falls back to key order
+ *	 if the scan output is used by a sort list it covers.
+ */
+bool
+qo_plan_iscan_oid_order (QO_PLAN * plan)
+{
+  QO_INDEX_ENTRY *index_entryp;
+
+  assert (plan != NULL);
+
+  if (!prm_get_bool_value (PRM_ID_OPTIMIZER_AUTO_INDEX_SCAN_OID_ORDER))
+    {
+      return false;
+    }
+
+  if (!qo_is_iscan (plan) || !plan->plan_un.scan.index_oid_order)
+    {
+      return false;
+    }
+
+  if (qo_is_index_covering_scan (plan) || qo_is_index_iss_scan (plan) || qo_is_index_loose_scan (plan)
+      || qo_plan_multi_range_opt (plan))
+    {
+      return false;
+    }
+
+  index_entryp = plan->plan_un.scan.index->head;
+  if (index_entryp->orderby_skip || index_entryp->groupby_skip)
+    {
+      /* key order is used instead of sorting */
+      return false;
+    }
+
+  return true;
+}
+
 /******************************************************************************
  *  qo_xasl support functions
  *****************************************************************************/
@@ -251,6 +251,8 @@ static QO_CLASS_INFO *qo_get_class_info (QO_ENV * env, QO_NODE * node);
 static QO_SEGMENT *qo_eqclass_wrt (QO_EQCLASS *, BITSET *);
 static void qo_env_dump (QO_ENV *, FILE *);
 static int qo_get_ils_prefix_length (QO_ENV * env, QO_NODE * nodep, QO_INDEX_ENTRY * index_entry);
+static bool qo_is_ils_hinted (QO_ENV * env, QO_NODE * nodep);
+static void qo_check_ils_statistics (QO_ENV * env, QO_NODE * nodep);
 static bool qo_is_iss_index (QO_ENV * env, QO_NODE * nodep, QO_INDEX_ENTRY * index_entry);
 static void qo_discover_sort_limit_join_nodes (QO_ENV * env, QO_NODE * nodep, BITSET * order_nodes, BITSET * dep_nodes);
 static bool qo_is_pk_fk_full_join (QO_ENV * env, QO_NODE * fk_node, QO_NODE * pk_node);
@@ -6772,9 +6774,14 @@ qo_get_ils_prefix_length (QO_ENV * env, QO_NODE * nodep, QO_INDEX_ENTRY * index_
 	  return 0;
 	}
     }
+  else if ((tree->info.query.q.select.hint & PT_HINT_INDEX_SS) && (QO_NODE_HINT (nodep) & PT_HINT_INDEX_SS))
+    {
+      return 0;			/* skip scan is requested instead */
+    }
   else
     {
-      return 0;			/* no hint */
+      /* no hint; go ahead, the index statistics decide later (see qo_check_ils_statistics) */
+      ;
     }
 
   if (PT_SELECT_INFO_IS_FLAGED (tree, PT_SELECT_INFO_DISABLE_LOOSE_SCAN))
@@ -6827,6 +6834,82 @@ qo_get_ils_prefix_length (QO_ENV * env, QO_NODE * nodep, QO_INDEX_ENTRY * index_
   return prefix_len;
 }
 
+/*
+ * qo_is_ils_hinted () - check if loose index scan was requested for a node
+ *   returns: true if the INDEX_LS hint applies to the node
+ *   env(in): environment
+ *   nodep(in): graph node
+ */
+static bool
+qo_is_ils_hinted (QO_ENV * env, QO_NODE * nodep)
+{
+  PT_NODE *tree;
+
+  tree = env->pt_tree;
+  QO_ASSERT (env, tree != NULL);
+
+  return (tree->node_type == PT_SELECT && (tree->info.query.q.select.hint & PT_HINT_INDEX_LS)
+	  && (QO_NODE_HINT (nodep) & PT_HINT_INDEX_LS));
+}
+
+/*
+ * qo_check_ils_statistics () - disable loose index scans which are not worth
+ *				it according to the index statistics
+ *   returns: nothing
+ *   env(in): environment
+ *   nodep(in): graph node
+ *
+ *   Notes: A loose index scan does one B+tree search for each distinct value
+ *          of the index prefix, instead of reading every leaf. Without the
+ *          INDEX_LS hint, it is used only when the partial-key statistics
+ *          say these searches read fewer pages than the leaves of the index.
+ */
+static void
+qo_check_ils_statistics (QO_ENV * env, QO_NODE * nodep)
+{
+  QO_NODE_INDEX *node_indexp;
+  QO_NODE_INDEX_ENTRY *ni_entryp;
+  QO_INDEX_ENTRY *index_entryp;
+  QO_ATTR_CUM_STATS *cum_statsp;
+  double prefix_keys, height;
+  bool use_ils;
+  int i, prefix_len;
+
+  node_indexp = QO_NODE_INDEXES (nodep);
+  if (node_indexp == NULL || qo_is_ils_hinted (env, nodep))
+    {
+      return;
+    }
+
+  for (i = 0, ni_entryp = QO_NI_ENTRY (node_indexp, 0); i < QO_NI_N (node_indexp); i++, ni_entryp++)
+    {
+      prefix_len = ni_entryp->head->ils_prefix_len;
+      if (prefix_len <= 0)
+	{
+	  continue;
+	}
+
+      cum_statsp = &ni_entryp->cum_stats;
+      use_ils = false;
+
+      if (cum_statsp->pkeys != NULL && prefix_len <= cum_statsp->pkeys_size && cum_statsp->pkeys[prefix_len - 1] > 0)
+	{
+	  prefix_keys = (double) cum_statsp->pkeys[prefix_len - 1];
+	  height = (double) MAX (cum_statsp->height, 1);
+
+	  use_ils = (prefix_keys * height < (double) cum_statsp->leafs);
+	}
+
+      if (!use_ils)
+	{
+	  for (index_entryp = ni_entryp->head; index_entryp != NULL; index_entryp = index_entryp->next)
+	    {
+	      index_entryp->ils_prefix_len = 0;
+	    }
+	}
+    }
+}
+
 /*
  * qo_is_iss_index () - check if we can use the Index Skip Scan optimization
  *   return: bool
@@ -7408,6 +7491,8 @@ qo_discover_indexes (QO_ENV * env)
 	      qo_find_node_indexes (env, nodep);
 	      /* collect statistic information on discovered indexes */
 	      qo_get_index_info (env, nodep);
+	      /* keep loose index scans that were not hinted only where they pay off */
+	      qo_check_ils_statistics (env, nodep);
 	    }
 	  else
 	    {
@@ -1450,6 +1450,7 @@ qo_scan_new (QO_INFO * info, QO_NODE * node, QO_SCANMETHOD scan_method)
   plan->plan_un.scan.index_cover = false;
   plan->plan_un.scan.index_iss = false;
   plan->plan_un.scan.index_loose = false;
+  plan->plan_un.scan.index_oid_order = false;
   plan->plan_un.scan.index = NULL;
 
   plan->multi_range_opt_use = PLAN_MULTI_RANGE_OPT_NO;
@@ -1867,10 +1868,10 @@ qo_iscan_cost (QO_PLAN * planp)
   QO_INDEX_ENTRY *index_entryp;
   double sel, sel_limit, objects, height, leaves, opages;
   bool is_null_sel;
-  double object_IO, index_IO;
+  double object_IO, index_IO, prefix_keys;
   QO_TERM *termp;
   BITSET_ITERATOR iter;
-  int i, t, n, pkeys_num;
+  int i, t, n, pkeys_num, prefix_len;
 
   nodep = planp->plan_un.scan.node;
   ni_entryp = planp->plan_un.scan.index;
@@ -2061,6 +2062,21 @@ qo_iscan_cost (QO_PLAN * planp)
 	}
     }
 
+  /* Loose Index Scan reads one key for each distinct value of the index prefix, each with a new B+tree search, instead
+   * of reading the leaves of the whole range
+   */
+  if (qo_is_index_loose_scan (planp))
+    {
+      prefix_len = index_entryp->ils_prefix_len;
+      if (prefix_len <= pkeys_num && cum_statsp->pkeys[prefix_len - 1] > 0)
+	{
+	  prefix_keys = (double) cum_statsp->pkeys[prefix_len - 1];
+
+	  index_IO = MIN (index_IO, prefix_keys * ((ni_entryp)->n * height + 1));
+	  objects = MIN (objects, prefix_keys);
+	}
+    }
+
   /* IO cost to fetch objects */
   if (sel < 0.3)
     {
@@ -2098,6 +2114,18 @@ qo_iscan_cost (QO_PLAN * planp)
     }
   object_IO = MAX (1.0, object_IO);
 
+  if (qo_is_index_covering_scan (planp))
+    {
+      /* A covering index scan returns the values from the leaf records and checks visibility with the MVCC info kept
+       * next to the OID; heap pages are not fixed at all. */
+      object_IO = 0.0;
+    }
+
+  /* Objects are read in key order, which is random order for the heap. When more objects than heap pages to be
+   * accessed are expected, the same pages are fixed several times or objects are read from disk one by one. Sorting
+   * the OID's before fetching them visits each page once and in physical order. */
+  planp->plan_un.scan.index_oid_order = (objects > 1.0 && opages > 1.0 && objects > object_IO);
+
   /* index scan requires more CPU cost than sequential scan */
 
   planp->fixed_cpu_cost = 0.0;
@@ -147,6 +147,7 @@ struct qo_plan
       bool index_cover;		/* covered index scan flag */
       bool index_iss;		/* index skip scan flag */
       bool index_loose;		/* loose index scan flag */
+      bool index_oid_order;	/* estimated to fetch objects faster in OID order */
       QO_NODE_INDEX_ENTRY *index;
     } scan;
 
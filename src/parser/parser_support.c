@@ -5132,6 +5132,7 @@ regu_srlistid_init (QFILE_SORTED_LIST_ID * ptr)
 {
   ptr->sorted = false;
   ptr->list_id = NULL;
+  ptr->hash_set = NULL;
 }
 
 /*
@@ -301,6 +301,14 @@ typedef struct corr_info
   UINTPTR id;
 } CORR_INFO;
 
+typedef struct memo_check_info
+{
+  PT_NODE *query;		/* query whose result would be memoized */
+  UINTPTR spec_id;		/* spec looked up in the query */
+  bool is_found;		/* the spec belongs to the query */
+  bool is_unsafe;		/* the query has an input that is not a correlated value */
+} MEMO_CHECK_INFO;
+
 FILE *query_Plan_dump_fp = NULL;
 char *query_Plan_dump_filename = NULL;
 
@@ -434,6 +442,10 @@ static AGGREGATE_TYPE *pt_to_aggregate (PARSER_CONTEXT * parser, PT_NODE * selec
 static SYMBOL_INFO *pt_push_symbol_info (PARSER_CONTEXT * parser, PT_NODE * select_node);
 
 static void pt_pop_symbol_info (PARSER_CONTEXT * parser);
+static void pt_add_correlated_value (SYMBOL_INFO * symbols, SYMBOL_INFO * home, DB_VALUE * dbval);
+static PT_NODE *pt_find_spec_id_node (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk);
+static PT_NODE *pt_is_outer_name_node (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk);
+static PT_NODE *pt_is_memo_unsafe_node (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk);
 
 static ACCESS_SPEC_TYPE *pt_make_class_access_spec (PARSER_CONTEXT * parser, PT_NODE * flat, DB_OBJECT * class_,
 						    TARGET_TYPE scan_type, ACCESS_METHOD access, INDX_INFO * indexptr,
@@ -3148,11 +3160,185 @@ pt_symbol_info_alloc (void)
       symbols->listfile_attr_offset = 0;
 
       symbols->query_node = NULL;
+      symbols->correlated_values = NULL;
+      symbols->has_unkeyed_correlation = false;
     }
 
   return symbols;
 }
 
+/*
+ * pt_add_correlated_value () - Records an outer value read by correlated
+ *                              queries
+ *   return:
+ *   symbols(in): symbol table of the query referencing the value
+ *   home(in): symbol table of the query producing the value
+ *   dbval(in): value placeholder, or NULL if the reference is not a value
+ *
+ * Note: The value is added to every query from the referencing one up to,
+ *       but excluding, the producing one. A query whose correlated values
+ *       are all known can have its results memoized by those values.
+ */
+static void
+pt_add_correlated_value (SYMBOL_INFO * symbols, SYMBOL_INFO * home, DB_VALUE * dbval)
+{
+  QPROC_DB_VALUE_LIST dbval_list;
+
+  for (; symbols != NULL && symbols != home; symbols = symbols->stack)
+    {
+      if (dbval == NULL)
+	{
+	  symbols->has_unkeyed_correlation = true;
+	  continue;
+	}
+
+      if (symbols->correlated_values == NULL)
+	{
+	  symbols->correlated_values = regu_vallist_alloc ();
+	  if (symbols->correlated_values == NULL)
+	    {
+	      symbols->has_unkeyed_correlation = true;
+	      continue;
+	    }
+	}
+
+      for (dbval_list = symbols->correlated_values->valp; dbval_list != NULL; dbval_list = dbval_list->next)
+	{
+	  if (dbval_list->val == dbval)
+	    {
+	      break;
+	    }
+	}
+      if (dbval_list != NULL)
+	{
+	  /* already known */
+	  continue;
+	}
+
+      dbval_list = regu_dbvlist_alloc ();
+      if (dbval_list == NULL)
+	{
+	  symbols->has_unkeyed_correlation = true;
+	  continue;
+	}
+      dbval_list->val = dbval;
+      dbval_list->next = symbols->correlated_values->valp;
+      symbols->correlated_values->valp = dbval_list;
+      symbols->correlated_values->val_cnt++;
+    }
+}
+
+/*
+ * pt_find_spec_id_node () - Looks for an entity spec in a query
+ *   return:
+ *   parser(in):
+ *   node(in):
+ *   arg(in/out): MEMO_CHECK_INFO *
+ *   continue_walk(in/out):
+ */
+static PT_NODE *
+pt_find_spec_id_node (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk)
+{
+  MEMO_CHECK_INFO *info = (MEMO_CHECK_INFO *) arg;
+
+  if (node->node_type == PT_SPEC && node->info.spec.id == info->spec_id)
+    {
+      info->is_found = true;
+      *continue_walk = PT_STOP_WALK;
+    }
+
+  return node;
+}
+
+/*
+ * pt_is_outer_name_node () - Checks for a name of an entity spec outside
+ *                            the query
+ *   return:
+ *   parser(in):
+ *   node(in):
+ *   arg(in/out): MEMO_CHECK_INFO *
+ *   continue_walk(in/out):
+ */
+static PT_NODE *
+pt_is_outer_name_node (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk)
+{
+  MEMO_CHECK_INFO *info = (MEMO_CHECK_INFO *) arg;
+
+  if (node->node_type == PT_NAME && node->info.name.spec_id != 0)
+    {
+      info->spec_id = node->info.name.spec_id;
+      info->is_found = false;
+      (void) parser_walk_tree (parser, info->query, pt_find_spec_id_node, info, NULL, NULL);
+      if (!info->is_found)
+	{
+	  info->is_unsafe = true;
+	  *continue_walk = PT_STOP_WALK;
+	}
+    }
+
+  return node;
+}
+
+/*
+ * pt_is_memo_unsafe_node () - Checks for query inputs other than the
+ *                             correlated values
+ *   return:
+ *   parser(in):
+ *   node(in):
+ *   arg(in/out): MEMO_CHECK_INFO *
+ *   continue_walk(in/out):
+ *
+ * Note: Non-deterministic expressions, expressions with side effects,
+ *       hierarchical pseudo-columns and aggregates over outer names make the
+ *       result of a query depend on more than the outer values it reads.
+ */
+static PT_NODE *
+pt_is_memo_unsafe_node (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, int *continue_walk)
+{
+  MEMO_CHECK_INFO *info = (MEMO_CHECK_INFO *) arg;
+
+  if (node->node_type == PT_METHOD_CALL)
+    {
+      info->is_unsafe = true;
+    }
+  else if (node->node_type == PT_EXPR)
+    {
+      switch (node->info.expr.op)
+	{
+	case PT_RAND:
+	case PT_DRAND:
+	case PT_RANDOM:
+	case PT_DRANDOM:
+	case PT_SYS_GUID:
+	case PT_NEXT_VALUE:
+	case PT_CURRENT_VALUE:
+	case PT_INCR:
+	case PT_DECR:
+	case PT_DEFINE_VARIABLE:
+	case PT_EVALUATE_VARIABLE:
+	case PT_SLEEP:
+	  info->is_unsafe = true;
+	  break;
+	default:
+	  info->is_unsafe = PT_REQUIRES_HIERARCHICAL_QUERY (node->info.expr.op);
+	  break;
+	}
+    }
+  else if (node->node_type == PT_FUNCTION
+	   && (pt_is_aggregate_function (parser, node) || pt_is_analytic_function (parser, node)))
+    {
+      /* an aggregate over outer names is computed by the outer query */
+      (void) parser_walk_tree (parser, node->info.function.arg_list, pt_is_outer_name_node, info, NULL, NULL);
+    }
+
+  if (info->is_unsafe)
+    {
+      *continue_walk = PT_STOP_WALK;
+    }
+
+  return node;
+}
+
 
 /*
  * pt_is_single_tuple () -
@@ -9338,6 +9524,9 @@ pt_attribute_to_regu (PARSER_CONTEXT * parser, PT_NODE * attr)
 			  regu = NULL;
 			}
 		    }
+
+		  /* remember the outer value in every query between here and the attribute's home */
+		  pt_add_correlated_value (parser->symbols, symbols, dbval);
 		}
 	      else
 		{
@@ -11751,6 +11940,11 @@ pt_to_class_spec_list (PARSER_CONTEXT * parser, PT_NODE * spec, PT_NODE * where_
 					   output_val_list, regu_var_list, cache_key, cache_pred, cache_rest,
 					   cache_range, NO_SCHEMA, NULL, NULL);
 
+	      if (access != NULL && qo_plan_iscan_oid_order (plan))
+		{
+		  access->flags = (ACCESS_SPEC_FLAG) (access->flags | ACCESS_SPEC_FLAG_OID_ORDER);
+		}
+
 	      if (ipl_where_part)
 		{
 		  parser_free_tree (parser, where_part);
@@ -20519,6 +20713,22 @@ parser_generate_xasl_post (PARSER_CONTEXT * parser, PT_NODE * node, void *arg, i
 
       /* build XASL for the query */
       xasl = parser_generate_xasl_proc (parser, node, info->query_list);
+      if (xasl != NULL && parser->symbols != NULL && parser->symbols->correlated_values != NULL
+	  && !parser->symbols->has_unkeyed_correlation)
+	{
+	  MEMO_CHECK_INFO memo_info;
+
+	  memo_info.query = node;
+	  memo_info.spec_id = 0;
+	  memo_info.is_found = false;
+	  memo_info.is_unsafe = false;
+	  (void) parser_walk_tree (parser, node, pt_is_memo_unsafe_node, &memo_info, NULL, NULL);
+	  if (!memo_info.is_unsafe)
+	    {
+	      /* the result depends only on these values, so it can be memoized by them */
+	      xasl->memo_key_list = parser->symbols->correlated_values;
+	    }
+	}
       pt_pop_symbol_info (parser);
       if (node->node_type == PT_SELECT)
 	{
@@ -79,6 +79,8 @@ struct symbol_info
   int listfile_attr_offset;
   PT_NODE *query_node;		/* the query node that is being translated */
   DB_VALUE **reserved_values;	/* db_values array used for reserved attributes */
+  VAL_LIST *correlated_values;	/* outer values read by the query, see pt_add_correlated_value */
+  bool has_unkeyed_correlation;	/* a correlated reference is not an outer value */
 };
 
 
@@ -3880,7 +3880,7 @@ fetch_peek_dbval (THREAD_ENTRY * thread_p, REGU_VARIABLE * regu_var, VAL_DESCR *
       REGU_VARIABLE_SET_FLAG (regu_var, REGU_VARIABLE_FETCH_NOT_CONST);
       assert (!REGU_VARIABLE_IS_FLAGED (regu_var, REGU_VARIABLE_FETCH_ALL_CONST));
       *peek_dbval = regu_var->value.attr_descr.cache_dbvalp;
-      if (*peek_dbval != NULL)
+      if (*peek_dbval != NULL && regu_var->value.attr_descr.cache_attrinfo->lazy_recdes == NULL)
 	{
 	  /* we have a cached pointer already */
 	  break;
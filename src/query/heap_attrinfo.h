@@ -35,7 +35,8 @@ typedef enum
   HEAP_READ_ATTRVALUE,
   HEAP_WRITTEN_ATTRVALUE,
   HEAP_UNINIT_ATTRVALUE,
-  HEAP_WRITTEN_LOB_ATTRVALUE
+  HEAP_WRITTEN_LOB_ATTRVALUE,
+  HEAP_UNREAD_ATTRVALUE		/* not decoded yet from lazy_recdes of the cache */
 } HEAP_ATTRVALUE_STATE;
 
 typedef enum
@@ -68,10 +69,14 @@ struct heap_cache_attrinfo
 				 * Otherwise, -1 */
   OR_CLASSREP *last_classrepr;	/* Currently cached catalog attribute info. */
   OR_CLASSREP *read_classrepr;	/* Currently cached catalog attribute info. */
+  int prev_read_cacheindex;	/* Cache index of prev_read_classrepr or -1 */
+  OR_CLASSREP *prev_read_classrepr;	/* Older representation read before read_classrepr; kept for heaps that mix
+					 * records of several representations. */
   OID inst_oid;			/* Instance Object identifier */
   int inst_chn;			/* Current chn of instance object */
   int num_values;		/* Number of desired attribute values */
   HEAP_ATTRVALUE *values;	/* Value for the attributes */
+  RECDES *lazy_recdes;		/* Record of HEAP_UNREAD_ATTRVALUE values; set only while a lazy read is in progress */
 };
 
 #endif /* _HEAP_ATTRINFO_H_ */
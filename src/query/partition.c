@@ -904,6 +904,7 @@ pruningset_to_spec_list (PRUNING_CONTEXT * pinfo, const PRUNING_BITSET * pruned)
     {
       COPY_OID (&spec[i].oid, &pinfo->partitions[pos + 1].class_oid);
       HFID_COPY (&spec[i].hfid, &pinfo->partitions[pos + 1].class_hfid);
+      spec[i].position = pos;
 
       if (i == cnt - 1)
 	{
@@ -2892,6 +2893,137 @@ partition_prune_spec (THREAD_ENTRY * thread_p, VAL_DESCR * vd, ACCESS_SPEC_TYPE
   return error;
 }
 
+/*
+ * partition_is_partitioned_alike () - check if two partitioned classes place
+ *				       equal partition keys in partitions of
+ *				       the same position
+ * return : error code or NO_ERROR
+ * thread_p (in)    :
+ * class_oid1 (in)  : first partitioned class
+ * class_oid2 (in)  : second partitioned class
+ * attr_id1 (out)   : partitioning attribute of the first class
+ * attr_id2 (out)   : partitioning attribute of the second class
+ * is_alike (out)   : true if the classes are partitioned alike
+ *
+ * Note: Both classes must be partitioned by the same method on an attribute
+ *	 of the same domain, with the same number of partitions and the same
+ *	 range limits or value lists, in the same order.
+ */
+int
+partition_is_partitioned_alike (THREAD_ENTRY * thread_p, const OID * class_oid1, const OID * class_oid2,
+				ATTR_ID * attr_id1, ATTR_ID * attr_id2, bool * is_alike)
+{
+  PRUNING_CONTEXT pinfo1, pinfo2;
+  REGU_VARIABLE *func_regu1, *func_regu2;
+  DB_VALUE val1, val2;
+  int error = NO_ERROR;
+  int i, j, size;
+
+  *is_alike = false;
+
+  (void) partition_init_pruning_context (&pinfo1);
+  (void) partition_init_pruning_context (&pinfo2);
+
+  error = partition_load_pruning_context (thread_p, class_oid1, DB_PARTITIONED_CLASS, &pinfo1);
+  if (error != NO_ERROR)
+    {
+      goto cleanup;
+    }
+  error = partition_load_pruning_context (thread_p, class_oid2, DB_PARTITIONED_CLASS, &pinfo2);
+  if (error != NO_ERROR)
+    {
+      goto cleanup;
+    }
+
+  if (pinfo1.partitions == NULL || pinfo2.partitions == NULL || pinfo1.partition_type != pinfo2.partition_type
+      || pinfo1.count != pinfo2.count)
+    {
+      goto cleanup;
+    }
+
+  func_regu1 = pinfo1.partition_pred->func_regu;
+  func_regu2 = pinfo2.partition_pred->func_regu;
+  if (func_regu1->type != TYPE_ATTR_ID || func_regu2->type != TYPE_ATTR_ID || func_regu1->domain == NULL
+      || func_regu2->domain == NULL || !tp_domain_match (func_regu1->domain, func_regu2->domain, TP_EXACT_MATCH))
+    {
+      /* equal keys might be placed differently */
+      goto cleanup;
+    }
+
+  if (pinfo1.partition_type == DB_PARTITION_HASH)
+    {
+      switch (TP_DOMAIN_TYPE (func_regu1->domain))
+	{
+	case DB_TYPE_INTEGER:
+	case DB_TYPE_SHORT:
+	case DB_TYPE_BIGINT:
+	case DB_TYPE_DATE:
+	case DB_TYPE_TIME:
+	case DB_TYPE_TIMESTAMP:
+	case DB_TYPE_DATETIME:
+	  break;
+	default:
+	  /* values that compare equal may hash differently (collations, signed zeros) */
+	  goto cleanup;
+	}
+    }
+
+  /* position 0 is the partitioned class itself */
+  for (i = 1; i < pinfo1.count; i++)
+    {
+      if (pinfo1.partitions[i].values == NULL || pinfo2.partitions[i].values == NULL)
+	{
+	  if (pinfo1.partitions[i].values != pinfo2.partitions[i].values)
+	    {
+	      goto cleanup;
+	    }
+	  continue;
+	}
+
+      size = db_set_size (pinfo1.partitions[i].values);
+      if (size != db_set_size (pinfo2.partitions[i].values))
+	{
+	  goto cleanup;
+	}
+
+      for (j = 0; j < size; j++)
+	{
+	  if (db_set_get (pinfo1.partitions[i].values, j, &val1) != NO_ERROR)
+	    {
+	      error = ER_FAILED;
+	      goto cleanup;
+	    }
+	  if (db_set_get (pinfo2.partitions[i].values, j, &val2) != NO_ERROR)
+	    {
+	      pr_clear_value (&val1);
+	      error = ER_FAILED;
+	      goto cleanup;
+	    }
+
+	  if (DB_IS_NULL (&val1) != DB_IS_NULL (&val2)
+	      || (!DB_IS_NULL (&val1) && tp_value_compare (&val1, &val2, 0, 1) != DB_EQ))
+	    {
+	      pr_clear_value (&val1);
+	      pr_clear_value (&val2);
+	      goto cleanup;
+	    }
+
+	  pr_clear_value (&val1);
+	  pr_clear_value (&val2);
+	}
+    }
+
+  *attr_id1 = pinfo1.attr_id;
+  *attr_id2 = pinfo2.attr_id;
+  *is_alike = true;
+
+cleanup:
+  partition_clear_pruning_context (&pinfo1);
+  partition_clear_pruning_context (&pinfo2);
+
+  return error;
+}
+
 /*
  * partition_find_partition_for_record () - find the partition in which a
  *					    record should be placed
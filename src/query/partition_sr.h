@@ -99,6 +99,9 @@ extern PRUNING_SCAN_CACHE *partition_new_scancache (PRUNING_CONTEXT * pcontext);
 
 extern int partition_prune_spec (THREAD_ENTRY * thread_p, VAL_DESCR * vd, ACCESS_SPEC_TYPE * access_spec);
 
+extern int partition_is_partitioned_alike (THREAD_ENTRY * thread_p, const OID * class_oid1, const OID * class_oid2,
+					   ATTR_ID * attr_id1, ATTR_ID * attr_id2, bool * is_alike);
+
 extern int partition_prune_insert (THREAD_ENTRY * thread_p, const OID * class_oid, RECDES * recdes,
 				   HEAP_SCANCACHE * scan_cache, PRUNING_CONTEXT * pcontext, int op_type,
 				   OID * pruned_class_oid, HFID * pruned_hfid, OID * superclass_oid);
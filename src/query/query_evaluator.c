@@ -40,20 +40,41 @@
 #include "query_executor.h"
 #include "thread.h"
 #include "dbtype.h"
+#include "memory_hash.h"
 
 #define UNKNOWN_CARD   -2	/* Unknown cardinality of a set member */
 
+/* in-memory hash set of the first column of an uncorrelated IN subquery list file */
+struct qfile_list_hash_set
+{
+  MHT_TABLE *ht;		/* values keyed by themselves */
+  DB_VALUE *values;		/* distinct bound values of the list file */
+  VPID first_vpid;		/* first page of the list file the set was built from */
+  int tuple_cnt;		/* tuple count of the list file the set was built from */
+  DB_TYPE type;			/* type of the hashed column */
+  bool has_null;		/* the list file has at least one unbound value */
+  bool is_usable;		/* false if the list file cannot be probed through the set */
+};
+
+#define EVAL_NATIVE_CMP(d1, d2) \
+  ((d1) < (d2) ? DB_LT : (d1) > (d2) ? DB_GT : DB_EQ)
+
 static DB_LOGICAL eval_negative (DB_LOGICAL res);
 static DB_LOGICAL eval_logical_result (DB_LOGICAL res1, DB_LOGICAL res2);
+static bool eval_value_rel_cmp_native (const DB_VALUE * dbval1, const DB_VALUE * dbval2, int *result);
 static DB_LOGICAL eval_value_rel_cmp (DB_VALUE * dbval1, DB_VALUE * dbval2, REL_OP rel_operator,
 				      COMP_EVAL_TERM * et_comp);
 static DB_LOGICAL eval_some_eval (DB_VALUE * item, DB_SET * set, REL_OP rel_operator);
 static DB_LOGICAL eval_all_eval (DB_VALUE * item, DB_SET * set, REL_OP rel_operator);
 static int eval_item_card_set (DB_VALUE * item, DB_SET * set, REL_OP rel_operator);
+static bool eval_is_hashable_list_type (DB_TYPE type);
+static int eval_build_list_hash_set (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id, QFILE_LIST_HASH_SET * hash_set);
+static int eval_get_list_hash_set (THREAD_ENTRY * thread_p, ALSM_EVAL_TERM * et_alsm, DB_VALUE * item,
+				   QFILE_LIST_HASH_SET ** hash_set_p);
 static DB_LOGICAL eval_some_list_eval (THREAD_ENTRY * thread_p, DB_VALUE * item, QFILE_LIST_ID * list_id,
-				       REL_OP rel_operator);
+				       REL_OP rel_operator, QFILE_LIST_HASH_SET * hash_set);
 static DB_LOGICAL eval_all_list_eval (THREAD_ENTRY * thread_p, DB_VALUE * item, QFILE_LIST_ID * list_id,
-				      REL_OP rel_operator);
+				      REL_OP rel_operator, QFILE_LIST_HASH_SET * hash_set);
 static int eval_item_card_sort_list (THREAD_ENTRY * thread_p, DB_VALUE * item, QFILE_LIST_ID * list_id);
 static DB_LOGICAL eval_sub_multi_set_to_sort_list (THREAD_ENTRY * thread_p, DB_SET * set1, QFILE_LIST_ID * list_id);
 static DB_LOGICAL eval_sub_sort_list_to_multi_set (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id, DB_SET * set);
@@ -81,6 +102,8 @@ static DB_LOGICAL eval_sort_list_to_sort_list (THREAD_ENTRY * thread_p, QFILE_LI
 					       QFILE_LIST_ID * list_id2, REL_OP rel_operator);
 static DB_LOGICAL eval_set_list_cmp (THREAD_ENTRY * thread_p, COMP_EVAL_TERM * et_comp, VAL_DESCR * vd,
 				     DB_VALUE * dbval1, DB_VALUE * dbval2);
+static bool eval_is_comp0_term (PRED_EXPR * pr);
+static bool eval_is_and_comp_chain (PRED_EXPR * pr);
 
 /*
  * eval_negative () - negate the result
@@ -134,6 +157,62 @@ eval_logical_result (DB_LOGICAL res1, DB_LOGICAL res2)
  * Predicate Evaluation
  */
 
+/*
+ * eval_value_rel_cmp_native () - Compare two values of the same fixed width
+ *                              type on their native representation
+ *   return: true if the values were compared, false if the generic
+ *           comparison is needed
+ *   dbval1(in): first db_value
+ *   dbval2(in): second db_value
+ *   result(out): DB_LT, DB_EQ or DB_GT
+ *
+ * Note: Most scan predicates compare a column with a value of the same
+ *       numeric or date/time type. These values are compared here the same
+ *       way their primitive types compare them, without the coercion and
+ *       collation checks of tp_value_compare_with_error ().
+ */
+static bool
+eval_value_rel_cmp_native (const DB_VALUE * dbval1, const DB_VALUE * dbval2, int *result)
+{
+  DB_TYPE type;
+
+  type = DB_VALUE_DOMAIN_TYPE (dbval1);
+  if (type != DB_VALUE_DOMAIN_TYPE (dbval2) || DB_IS_NULL (dbval1) || DB_IS_NULL (dbval2))
+    {
+      return false;
+    }
+
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+      *result = EVAL_NATIVE_CMP (db_get_int (dbval1), db_get_int (dbval2));
+      return true;
+    case DB_TYPE_SHORT:
+      *result = EVAL_NATIVE_CMP (db_get_short (dbval1), db_get_short (dbval2));
+      return true;
+    case DB_TYPE_BIGINT:
+      *result = EVAL_NATIVE_CMP (db_get_bigint (dbval1), db_get_bigint (dbval2));
+      return true;
+    case DB_TYPE_FLOAT:
+      *result = EVAL_NATIVE_CMP (db_get_float (dbval1), db_get_float (dbval2));
+      return true;
+    case DB_TYPE_DOUBLE:
+      *result = EVAL_NATIVE_CMP (db_get_double (dbval1), db_get_double (dbval2));
+      return true;
+    case DB_TYPE_DATE:
+      *result = EVAL_NATIVE_CMP (*db_get_date (dbval1), *db_get_date (dbval2));
+      return true;
+    case DB_TYPE_TIME:
+      *result = EVAL_NATIVE_CMP (*db_get_time (dbval1), *db_get_time (dbval2));
+      return true;
+    case DB_TYPE_TIMESTAMP:
+      *result = EVAL_NATIVE_CMP (*db_get_timestamp (dbval1), *db_get_timestamp (dbval2));
+      return true;
+    default:
+      return false;
+    }
+}
+
 /*
  * eval_value_rel_cmp () - Compare two db_values according to the given
  *                       relational operator
@@ -169,6 +248,12 @@ eval_value_rel_cmp (DB_VALUE * dbval1, DB_VALUE * dbval2, REL_OP rel_operator, C
       break;
 
     default:
+      /* same type values that need no coercion nor collation */
+      if (eval_value_rel_cmp_native (dbval1, dbval2, &result))
+	{
+	  break;
+	}
+
       /* check for constant values to coerce 1-time, then reduce many-times coerce at tp_value_compare_with_error () */
       if (et_comp != NULL)
 	{
@@ -501,12 +586,256 @@ eval_item_card_set (DB_VALUE * item, DB_SET * set, REL_OP rel_operator)
  * List File Related Evaluation
  */
 
+/*
+ * eval_is_hashable_list_type () -
+ *   return: true if equality of two values of the type can be decided by hashing
+ *   type(in): type of the list file column
+ *
+ * Note: Only fixed-width types whose equality is exact are accepted; strings
+ *       (collations, trailing spaces) and floating point values (signed
+ *       zeros) keep using the comparison routines.
+ */
+static bool
+eval_is_hashable_list_type (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_SHORT:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+      return true;
+    default:
+      return false;
+    }
+}
+
+/*
+ * eval_build_list_hash_set () -
+ *   return: NO_ERROR, or error code
+ *   list_id(in): list file identifier
+ *   hash_set(in/out): hash set to fill
+ *
+ * Note: Loads the distinct bound values of the first column of the list file
+ *       into the hash set and remembers whether an unbound value was seen.
+ *       The set is left unusable if the column type cannot be hashed or if
+ *       the set would exceed max_subquery_hash_size.
+ */
+static int
+eval_build_list_hash_set (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id, QFILE_LIST_HASH_SET * hash_set)
+{
+  QFILE_LIST_SCAN_ID s_id;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  SCAN_CODE qp_scan;
+  PR_TYPE *pr_type;
+  OR_BUF buf;
+  DB_VALUE *value;
+  const void *put;
+  UINT64 mem_size;
+  int n_values, length;
+  char *ptr;
+
+  if (list_id->type_list.domp == NULL || list_id->type_list.domp[0]->type == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  pr_type = list_id->type_list.domp[0]->type;
+  if (!eval_is_hashable_list_type (pr_type->id))
+    {
+      return NO_ERROR;
+    }
+
+  mem_size = (UINT64) list_id->tuple_cnt * (sizeof (DB_VALUE) + sizeof (HENTRY));
+  if (mem_size > (UINT64) prm_get_integer_value (PRM_ID_MAX_SUBQUERY_HASH_SIZE))
+    {
+      return NO_ERROR;
+    }
+
+  hash_set->values = (DB_VALUE *) malloc (list_id->tuple_cnt * sizeof (DB_VALUE));
+  if (hash_set->values == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, list_id->tuple_cnt * sizeof (DB_VALUE));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  hash_set->ht = mht_create ("IN subquery hash set", list_id->tuple_cnt, mht_valhash, mht_compare_dbvalues_are_equal);
+  if (hash_set->ht == NULL)
+    {
+      goto exit_on_error;
+    }
+
+  if (qfile_open_list_scan (list_id, &s_id) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  n_values = 0;
+  while ((qp_scan = qfile_scan_list_next (thread_p, &s_id, &tplrec, PEEK)) == S_SUCCESS)
+    {
+      if (qfile_locate_tuple_value (tplrec.tpl, 0, &ptr, &length) == V_UNBOUND)
+	{
+	  hash_set->has_null = true;
+	  continue;
+	}
+
+      value = &hash_set->values[n_values];
+      OR_BUF_INIT (buf, ptr, length);
+      if ((*(pr_type->data_readval)) (&buf, value, list_id->type_list.domp[0], -1, true, NULL, 0) != NO_ERROR)
+	{
+	  qfile_close_scan (thread_p, &s_id);
+	  goto exit_on_error;
+	}
+
+      put = mht_put_if_not_exists (hash_set->ht, value, value);
+      if (put == NULL)
+	{
+	  qfile_close_scan (thread_p, &s_id);
+	  goto exit_on_error;
+	}
+      else if (put == value)
+	{
+	  /* a new distinct value; otherwise the slot is reused */
+	  n_values++;
+	}
+    }
+
+  qfile_close_scan (thread_p, &s_id);
+  if (qp_scan != S_END)
+    {
+      goto exit_on_error;
+    }
+
+  hash_set->type = pr_type->id;
+  hash_set->is_usable = true;
+
+  return NO_ERROR;
+
+exit_on_error:
+  if (hash_set->ht != NULL)
+    {
+      mht_destroy (hash_set->ht);
+      hash_set->ht = NULL;
+    }
+  free_and_init (hash_set->values);
+
+  return ER_FAILED;
+}
+
+/*
+ * eval_get_list_hash_set () -
+ *   return: NO_ERROR, or error code
+ *   et_alsm(in): IN / NOT IN predicate on a subquery list file
+ *   item(in): bound value to probe
+ *   hash_set_p(out): hash set to probe, or NULL if the list file must be scanned
+ *
+ * Note: x IN (subquery) and x NOT IN (subquery) reduce to an equality
+ *       lookup on the values of the subquery. When the subquery is not
+ *       correlated its list file is built once per execution, so it is
+ *       turned into an in-memory hash set on the first probe and every
+ *       outer row then costs one hash lookup instead of a list file scan.
+ */
+static int
+eval_get_list_hash_set (THREAD_ENTRY * thread_p, ALSM_EVAL_TERM * et_alsm, DB_VALUE * item,
+			QFILE_LIST_HASH_SET ** hash_set_p)
+{
+  XASL_NODE *xasl;
+  QFILE_SORTED_LIST_ID *srlist_id;
+  QFILE_LIST_ID *list_id;
+  QFILE_LIST_HASH_SET *hash_set;
+
+  *hash_set_p = NULL;
+
+  if (!((et_alsm->eq_flag == F_SOME && et_alsm->rel_op == R_EQ)
+	|| (et_alsm->eq_flag == F_ALL && et_alsm->rel_op == R_NE)))
+    {
+      return NO_ERROR;
+    }
+
+  /* the list file of a correlated subquery is rebuilt for every outer row */
+  xasl = REGU_VARIABLE_XASL (et_alsm->elemset);
+  if (xasl == NULL || !XASL_IS_FLAGED (xasl, XASL_ZERO_CORR_LEVEL))
+    {
+      return NO_ERROR;
+    }
+
+  srlist_id = et_alsm->elemset->value.srlist_id;
+  list_id = srlist_id->list_id;
+  hash_set = srlist_id->hash_set;
+  if (hash_set != NULL
+      && (hash_set->tuple_cnt != list_id->tuple_cnt || !VPID_EQ (&hash_set->first_vpid, &list_id->first_vpid)))
+    {
+      /* built from a previous result of the subquery */
+      eval_free_list_hash_set (hash_set);
+      srlist_id->hash_set = hash_set = NULL;
+    }
+
+  if (hash_set == NULL)
+    {
+      hash_set = (QFILE_LIST_HASH_SET *) malloc (sizeof (QFILE_LIST_HASH_SET));
+      if (hash_set == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (QFILE_LIST_HASH_SET));
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+
+      hash_set->ht = NULL;
+      hash_set->values = NULL;
+      VPID_COPY (&hash_set->first_vpid, &list_id->first_vpid);
+      hash_set->tuple_cnt = list_id->tuple_cnt;
+      hash_set->type = DB_TYPE_NULL;
+      hash_set->has_null = false;
+      hash_set->is_usable = false;
+      srlist_id->hash_set = hash_set;
+
+      if (eval_build_list_hash_set (thread_p, list_id, hash_set) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+    }
+
+  if (hash_set->is_usable && DB_VALUE_DOMAIN_TYPE (item) == hash_set->type)
+    {
+      *hash_set_p = hash_set;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * eval_free_list_hash_set () -
+ *   return:
+ *   hash_set(in): hash set built for an IN subquery list file
+ */
+void
+eval_free_list_hash_set (QFILE_LIST_HASH_SET * hash_set)
+{
+  if (hash_set == NULL)
+    {
+      return;
+    }
+
+  if (hash_set->ht != NULL)
+    {
+      mht_destroy (hash_set->ht);
+    }
+  if (hash_set->values != NULL)
+    {
+      free_and_init (hash_set->values);
+    }
+  free_and_init (hash_set);
+}
+
 /*
  * eval_some_list_eval () -
  *   return: DB_LOGICAL (V_TRUE, V_FALSE, V_UNKNOWN, V_ERROR)
  *   item(in): db_value item
  *   list_id(in): list file identifier
  *   rel_operator(in): relational comparison operator
+ *   hash_set(in): hash set of the list file for an equality probe (optional)
  *
  * Note: This routine tries to determine whether a specific relation
  *              as determined by the relational operator rel_operator holds between
@@ -528,7 +857,8 @@ eval_item_card_set (DB_VALUE * item, DB_SET * set, REL_OP rel_operator)
  *        one of the list elements.
  */
 static DB_LOGICAL
-eval_some_list_eval (THREAD_ENTRY * thread_p, DB_VALUE * item, QFILE_LIST_ID * list_id, REL_OP rel_operator)
+eval_some_list_eval (THREAD_ENTRY * thread_p, DB_VALUE * item, QFILE_LIST_ID * list_id, REL_OP rel_operator,
+		     QFILE_LIST_HASH_SET * hash_set)
 {
   DB_LOGICAL res, t_res;
   QFILE_LIST_SCAN_ID s_id;
@@ -553,6 +883,17 @@ eval_some_list_eval (THREAD_ENTRY * thread_p, DB_VALUE * item, QFILE_LIST_ID * l
       return V_FALSE;		/* empty set */
     }
 
+  if (hash_set != NULL)
+    {
+      assert (rel_operator == R_EQ);
+      if (mht_get (hash_set->ht, item) != NULL)
+	{
+	  return V_TRUE;
+	}
+      /* an unbound member can not be determined not to be equal */
+      return hash_set->has_null ? V_UNKNOWN : V_FALSE;
+    }
+
   if (qfile_open_list_scan (list_id, &s_id) != NO_ERROR)
     {
       return V_ERROR;
@@ -608,6 +949,7 @@ eval_some_list_eval (THREAD_ENTRY * thread_p, DB_VALUE * item, QFILE_LIST_ID * l
  *   item(in): db_value
  *   list_id(in): list file identifier
  *   rel_operator(in): relational comparison operator
+ *   hash_set(in): hash set of the list file, given only for <> ALL (optional)
  *
  * Note: This routine tries to determine whether a specific relation
  *              as determined by the relational operator rel_operator holds between
@@ -627,7 +969,8 @@ eval_some_list_eval (THREAD_ENTRY * thread_p, DB_VALUE * item, QFILE_LIST_ID * l
  *
  */
 static DB_LOGICAL
-eval_all_list_eval (THREAD_ENTRY * thread_p, DB_VALUE * item, QFILE_LIST_ID * list_id, REL_OP rel_operator)
+eval_all_list_eval (THREAD_ENTRY * thread_p, DB_VALUE * item, QFILE_LIST_ID * list_id, REL_OP rel_operator,
+		    QFILE_LIST_HASH_SET * hash_set)
 {
   DB_LOGICAL some_res;
 
@@ -657,7 +1000,7 @@ eval_all_list_eval (THREAD_ENTRY * thread_p, DB_VALUE * item, QFILE_LIST_ID * li
       return V_ERROR;
     }
 
-  some_res = eval_some_list_eval (thread_p, item, list_id, rel_operator);
+  some_res = eval_some_list_eval (thread_p, item, list_id, rel_operator, hash_set);
   /* negate the result */
   return eval_negative (some_res);
 }
@@ -1655,6 +1998,7 @@ eval_pred (THREAD_ENTRY * thread_p, PRED_EXPR * pr, VAL_DESCR * vd, OID * obj_oi
   int regexp_res;
   PRED_EXPR *t_pr;
   QFILE_SORTED_LIST_ID *srlist_id;
+  QFILE_LIST_HASH_SET *hash_set;
 
   peek_val1 = NULL;
   peek_val2 = NULL;
@@ -1985,13 +2329,19 @@ eval_pred (THREAD_ENTRY * thread_p, PRED_EXPR * pr, VAL_DESCR * vd, OID * obj_oi
 	      {
 		/* rhs value is a list, use list evaluation routines */
 		srlist_id = et_alsm->elemset->value.srlist_id;
+		if (eval_get_list_hash_set (thread_p, et_alsm, peek_val1, &hash_set) != NO_ERROR)
+		  {
+		    result = V_ERROR;
+		    goto exit;
+		  }
+
 		if (et_alsm->eq_flag == F_ALL)
 		  {
-		    result = eval_all_list_eval (thread_p, peek_val1, srlist_id->list_id, et_alsm->rel_op);
+		    result = eval_all_list_eval (thread_p, peek_val1, srlist_id->list_id, et_alsm->rel_op, hash_set);
 		  }
 		else
 		  {
-		    result = eval_some_list_eval (thread_p, peek_val1, srlist_id->list_id, et_alsm->rel_op);
+		    result = eval_some_list_eval (thread_p, peek_val1, srlist_id->list_id, et_alsm->rel_op, hash_set);
 		  }
 	      }
 	    else if (rhs_is_set)
@@ -2368,6 +2718,7 @@ eval_pred_alsm5 (THREAD_ENTRY * thread_p, PRED_EXPR * pr, VAL_DESCR * vd, OID *
   ALSM_EVAL_TERM *et_alsm;
   DB_VALUE *peek_val1;
   QFILE_SORTED_LIST_ID *srlist_id;
+  QFILE_LIST_HASH_SET *hash_set;
 
   peek_val1 = NULL;
 
@@ -2401,13 +2752,18 @@ eval_pred_alsm5 (THREAD_ENTRY * thread_p, PRED_EXPR * pr, VAL_DESCR * vd, OID *
       return V_UNKNOWN;
     }
 
+  if (eval_get_list_hash_set (thread_p, et_alsm, peek_val1, &hash_set) != NO_ERROR)
+    {
+      return V_ERROR;
+    }
+
   if (et_alsm->eq_flag == F_ALL)
     {
-      return eval_all_list_eval (thread_p, peek_val1, srlist_id->list_id, et_alsm->rel_op);
+      return eval_all_list_eval (thread_p, peek_val1, srlist_id->list_id, et_alsm->rel_op, hash_set);
     }
   else
     {
-      return eval_some_list_eval (thread_p, peek_val1, srlist_id->list_id, et_alsm->rel_op);
+      return eval_some_list_eval (thread_p, peek_val1, srlist_id->list_id, et_alsm->rel_op, hash_set);
     }
 }
 
@@ -2528,6 +2884,101 @@ eval_pred_rlike7 (THREAD_ENTRY * thread_p, PRED_EXPR * pr, VAL_DESCR * vd, OID *
   return (DB_LOGICAL) regexp_res;
 }
 
+/*
+ * eval_pred_and_comp8 () -
+ *   return: DB_LOGICAL (V_TRUE, V_FALSE, V_UNKNOWN or V_ERROR)
+ *   pr(in): Predicate Expression Tree
+ *   vd(in): Value descriptor for positional values (optional)
+ *   obj_oid(in): Object Identifier
+ *
+ * Note: conjunction of regular comparison predicates; the right-linear AND
+ *       chain is walked in a loop and each term is evaluated by
+ *       eval_pred_comp0 () without going through eval_pred ().
+ */
+DB_LOGICAL
+eval_pred_and_comp8 (THREAD_ENTRY * thread_p, PRED_EXPR * pr, VAL_DESCR * vd, OID * obj_oid)
+{
+  PRED_EXPR *t_pr;
+  DB_LOGICAL result, term_result;
+
+  result = V_TRUE;
+  for (t_pr = pr; t_pr->type == T_PRED; t_pr = t_pr->pe.pred.rhs)
+    {
+      assert (t_pr->pe.pred.bool_op == B_AND);
+
+      term_result = eval_pred_comp0 (thread_p, t_pr->pe.pred.lhs, vd, obj_oid);
+      if (term_result == V_FALSE || term_result == V_ERROR)
+	{
+	  return term_result;
+	}
+      else if (term_result == V_UNKNOWN)
+	{
+	  /* the conjunction is UNKNOWN, unless a following term is FALSE */
+	  result = V_UNKNOWN;
+	}
+    }
+
+  term_result = eval_pred_comp0 (thread_p, t_pr, vd, obj_oid);
+  if (term_result != V_TRUE)
+    {
+      return term_result;
+    }
+
+  return result;
+}
+
+/*
+ * eval_is_comp0_term () - check if the predicate is a single node regular
+ *                         comparison, evaluated by eval_pred_comp0 ()
+ *   return: true/false
+ *   pr(in): Predicate Expression Tree
+ */
+static bool
+eval_is_comp0_term (PRED_EXPR * pr)
+{
+  COMP_EVAL_TERM *et_comp;
+
+  if (pr == NULL || pr->type != T_EVAL_TERM || pr->pe.eval_term.et_type != T_COMP_EVAL_TERM)
+    {
+      return false;
+    }
+
+  et_comp = &pr->pe.eval_term.et.et_comp;
+  if (et_comp->rel_op == R_NULL || et_comp->rel_op == R_EXISTS)
+    {
+      return false;
+    }
+
+  return (et_comp->lhs->type != TYPE_LIST_ID && et_comp->rhs->type != TYPE_LIST_ID);
+}
+
+/*
+ * eval_is_and_comp_chain () - check if the predicate is a conjunction of
+ *                             regular comparisons only
+ *   return: true/false
+ *   pr(in): Predicate Expression Tree
+ */
+static bool
+eval_is_and_comp_chain (PRED_EXPR * pr)
+{
+  PRED_EXPR *t_pr;
+
+  if (pr == NULL || pr->type != T_PRED || pr->pe.pred.bool_op != B_AND)
+    {
+      return false;
+    }
+
+  for (t_pr = pr; t_pr->type == T_PRED; t_pr = t_pr->pe.pred.rhs)
+    {
+      if (t_pr->pe.pred.bool_op != B_AND || !eval_is_comp0_term (t_pr->pe.pred.lhs))
+	{
+	  return false;
+	}
+    }
+
+  return eval_is_comp0_term (t_pr);
+}
+
 /*
  * eval_fnc () -
  *   return:
@@ -2598,6 +3049,11 @@ eval_fnc (THREAD_ENTRY * thread_p, PRED_EXPR * pr, DB_TYPE * single_node_type)
 	}
     }
 
+  if (eval_is_and_comp_chain (pr))
+    {
+      return (PR_EVAL_FNC) eval_pred_and_comp8;
+    }
+
   /* general case */
   return (PR_EVAL_FNC) eval_pred;
 }
@@ -2743,6 +3199,7 @@ eval_data_filter (THREAD_ENTRY * thread_p, OID * oid, RECDES * recdesp, HEAP_SCA
   SCAN_PRED *scan_predp;
   SCAN_ATTRS *scan_attrsp;
   DB_LOGICAL ev_res;
+  HEAP_CACHE_ATTRINFO *lazy_attr_cache = NULL;
 
   if (!filterp)
     {
@@ -2758,8 +3215,18 @@ eval_data_filter (THREAD_ENTRY * thread_p, OID * oid, RECDES * recdesp, HEAP_SCA
 
   if (scan_attrsp != NULL && scan_attrsp->attr_cache != NULL && scan_predp->regu_list != NULL)
     {
+      if (oid != NULL && recdesp != NULL && recdesp->data != NULL && scan_attrsp->attr_cache->num_values > 1)
+	{
+	  /* decode each predicate value when the predicate first needs it; terms that come after a false one in a
+	   * conjunction do not pay for decoding their attributes */
+	  if (heap_attrinfo_read_dbvalues_lazy (thread_p, oid, recdesp, scan_attrsp->attr_cache) != NO_ERROR)
+	    {
+	      return V_ERROR;
+	    }
+	  lazy_attr_cache = scan_attrsp->attr_cache;
+	}
       /* read the predicate values from the heap into the attribute cache */
-      if (heap_attrinfo_read_dbvalues (thread_p, oid, recdesp, scan_cache, scan_attrsp->attr_cache) != NO_ERROR)
+      else if (heap_attrinfo_read_dbvalues (thread_p, oid, recdesp, scan_cache, scan_attrsp->attr_cache) != NO_ERROR)
 	{
 	  return V_ERROR;
 	}
@@ -2802,7 +3269,16 @@ eval_data_filter (THREAD_ENTRY * thread_p, OID * oid, RECDES * recdesp, HEAP_SCA
       if (fetch_val_list (thread_p, scan_predp->regu_list, filterp->val_descr, filterp->class_oid, oid, NULL, PEEK) !=
 	  NO_ERROR)
 	{
-	  return V_ERROR;
+	  ev_res = V_ERROR;
+	}
+    }
+
+  if (lazy_attr_cache != NULL)
+    {
+      /* values of a qualified object are all decoded, as they were before lazy reads */
+      if (heap_attrinfo_end_lazy_read (lazy_attr_cache, ev_res == V_TRUE) != NO_ERROR)
+	{
+	  ev_res = V_ERROR;
 	}
     }
 
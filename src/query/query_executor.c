@@ -108,6 +108,16 @@
 /* maximum selectivity allowed for hash aggregate evaluation */
 #define HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD         0.5f
 
+/* default number of memoized results of a correlated subquery */
+#define SUBQUERY_MEMO_DEFAULT_TABLE_SIZE 256
+
+/* minimum amount of lookups in the memo cache of a correlated subquery
+   before deciding if the outer values repeat often enough */
+#define SUBQUERY_MEMO_LOOKUP_THRESHOLD  200
+
+/* maximum ratio of memo cache misses allowed before memoization is abandoned */
+#define SUBQUERY_MEMO_MISS_THRESHOLD    0.9f
+
 
 #define QEXEC_CLEAR_AGG_LIST_VALUE(agg_list) \
   do \
@@ -329,6 +339,36 @@ struct del_lob_info
   DEL_LOB_INFO *next;		/* next DEL_LOB_INFO in a list */
 };
 
+/* key of a memoized correlated subquery result: the packed outer values */
+typedef struct xasl_memo_key XASL_MEMO_KEY;
+struct xasl_memo_key
+{
+  int size;			/* size of packed values */
+  char *data;			/* packed values */
+};
+
+/* memoized result of a single tuple correlated subquery */
+typedef struct xasl_memo_entry XASL_MEMO_ENTRY;
+struct xasl_memo_entry
+{
+  XASL_MEMO_KEY key;		/* packed outer values, data follows the entry */
+  int val_cnt;			/* number of values in the single tuple */
+  DB_VALUE *values;		/* single tuple values */
+  int size;			/* memory used by the entry */
+};
+
+/* memo cache of a correlated subquery, kept for one execution */
+struct xasl_memo_cache
+{
+  MHT_TABLE *ht;		/* XASL_MEMO_KEY -> XASL_MEMO_ENTRY, with LRU list */
+  char *key_buf;		/* buffer used to pack the key of a lookup */
+  int key_buf_size;		/* size of key_buf */
+  UINT64 size;			/* memory used by the cached entries */
+  int lookup_cnt;		/* number of lookups */
+  int miss_cnt;			/* number of lookups that executed the subquery */
+  bool is_disabled;		/* outer values hardly repeat, memoization was abandoned */
+};
+
 /* used for internal update/delete execution */
 typedef struct upddel_class_info_internal UPDDEL_CLASS_INFO_INTERNAL;
 struct upddel_class_info_internal
@@ -503,6 +543,13 @@ static SCAN_CODE qexec_next_scan_block (THREAD_ENTRY * thread_p, XASL_NODE * xas
 static SCAN_CODE qexec_next_scan_block_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
 static SCAN_CODE qexec_execute_scan (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 				     QFILE_TUPLE_RECORD * ignore, XASL_SCAN_FNC_PTR next_scan_fnc);
+static bool qexec_is_spec_attr_value (ACCESS_SPEC_TYPE * spec, ATTR_ID attr_id, REGU_VARIABLE * regu);
+static bool qexec_is_partition_join_term (PRED_EXPR * pred, ATTR_ID inner_attr_id, ACCESS_SPEC_TYPE * outer_spec,
+					  ATTR_ID outer_attr_id);
+static bool qexec_is_partition_join_key (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * inner_spec,
+					 ATTR_ID inner_attr_id, ACCESS_SPEC_TYPE * outer_spec, ATTR_ID outer_attr_id);
+static void qexec_check_partition_wise_join (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
+static bool qexec_is_partition_pair_disjoint (XASL_NODE * xasl);
 static SCAN_CODE qexec_intprt_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 				   QFILE_TUPLE_RECORD * tplrec, XASL_SCAN_FNC_PTR next_scan_fnc);
 static SCAN_CODE qexec_merge_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
@@ -653,9 +700,21 @@ static BH_CMP_RESULT qexec_topn_compare (const void *left, const void *right, BH
 static BH_CMP_RESULT qexec_topn_cmpval (DB_VALUE * left, DB_VALUE * right, SORT_LIST * sort_spec);
 static TOPN_STATUS qexec_add_tuple_to_topn (THREAD_ENTRY * thread_p, TOPN_TUPLES * sort_stop,
 					    QFILE_TUPLE_DESCRIPTOR * tpldescr);
+static bool qexec_topn_regu_has_side_effects (REGU_VARIABLE * regu);
+static bool qexec_topn_pred_has_side_effects (PRED_EXPR * pred);
+static bool qexec_topn_reject_by_keys (THREAD_ENTRY * thread_p, TOPN_TUPLES * topn_items, VALPTR_LIST * outptr_list,
+				       VAL_DESCR * vd);
 static int qexec_topn_tuples_to_list_id (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 					 bool is_final);
 static void qexec_clear_topn_tuple (THREAD_ENTRY * thread_p, TOPN_TUPLE * tuple, int count);
+static unsigned int qexec_memo_hash_key (const void *key, unsigned int ht_size);
+static int qexec_memo_key_eq (const void *key1, const void *key2);
+static int qexec_memo_free_entry (const void *key, void *data, void *args);
+static int qexec_memo_pack_key (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_MEMO_CACHE * cache,
+				XASL_MEMO_KEY * key);
+static int qexec_memo_save_result (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_MEMO_CACHE * cache,
+				   XASL_MEMO_KEY * key);
+static void qexec_free_memo_cache (THREAD_ENTRY * thread_p, XASL_MEMO_CACHE * cache);
 static int qexec_get_orderbynum_upper_bound (THREAD_ENTRY * tread_p, PRED_EXPR * pred, VAL_DESCR * vd,
 					     DB_VALUE * ubound);
 static int qexec_analytic_evaluate_cume_dist_percent_rank_function (THREAD_ENTRY * thread_p,
@@ -1137,6 +1196,13 @@ qexec_end_one_iteration (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
 	  GOTO_EXIT_ON_ERROR;
 	}
 
+      if (xasl->topn_items != NULL
+	  && qexec_topn_reject_by_keys (thread_p, xasl->topn_items, xasl->outptr_list, &xasl_state->vd))
+	{
+	  /* the tuple cannot enter the top-n heap; do not evaluate the rest of its columns */
+	  return NO_ERROR;
+	}
+
       tpldescr_status = qexec_generate_tuple_descriptor (thread_p, xasl->list_id, xasl->outptr_list, &xasl_state->vd);
       if (tpldescr_status == QPROC_TPLDESCR_FAILURE)
 	{
@@ -1480,6 +1546,13 @@ qexec_clear_regu_var (XASL_NODE * xasl_p, REGU_VARIABLE * regu_var, bool is_fina
 	}
       /* Fall through */
     case TYPE_LIST_ID:
+      if (regu_var->type == TYPE_LIST_ID && regu_var->value.srlist_id != NULL
+	  && regu_var->value.srlist_id->hash_set != NULL)
+	{
+	  /* the hash set of an IN subquery lives as long as the subquery list file */
+	  eval_free_list_hash_set (regu_var->value.srlist_id->hash_set);
+	  regu_var->value.srlist_id->hash_set = NULL;
+	}
       if (regu_var->xasl != NULL)
 	{
 	  if (xcache_uses_clones ())
@@ -2090,6 +2163,13 @@ qexec_clear_xasl (THREAD_ENTRY * thread_p, XASL_NODE * xasl, bool is_final)
   /* clear the head node */
   pg_cnt += qexec_clear_xasl_head (thread_p, xasl);
 
+  /* memoized results are valid for one execution only */
+  if (xasl->memo_cache != NULL)
+    {
+      qexec_free_memo_cache (thread_p, xasl->memo_cache);
+      xasl->memo_cache = NULL;
+    }
+
 #if defined (ENABLE_COMPOSITE_LOCK)
   /* free alloced memory for composite locking */
   assert (xasl->composite_lock.lockcomp.class_list == NULL);
@@ -3728,8 +3808,8 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 	  *output_tuple = false;
 	}
 
-      /* add to hash table */
-      mht_put (context->hash_table, (void *) new_key, (void *) new_value);
+      /* add to hash table; the probe above found no entry for this key, so skip the duplicate key search */
+      mht_put_new (context->hash_table, (void *) new_key, (void *) new_value);
 
       /* count new group and tuple; we're not aggregating the tuple just yet but the count is used for statistic
        * computations */
@@ -6547,7 +6627,8 @@ qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST
       /* open a list file scan */
       if (scan_open_list_scan (thread_p, s_id, grouped, curr_spec->single_fetch, curr_spec->s_dbval, val_list, vd,
 			       ACCESS_SPEC_LIST_ID (curr_spec), curr_spec->s.list_node.list_regu_list_pred,
-			       curr_spec->where_pred, curr_spec->s.list_node.list_regu_list_rest) != NO_ERROR)
+			       curr_spec->where_pred, curr_spec->s.list_node.list_regu_list_rest,
+			       XASL_IS_FLAGED (ACCESS_SPEC_XASL_NODE (curr_spec), XASL_ZERO_CORR_LEVEL)) != NO_ERROR)
 	{
 	  goto exit_on_error;
 	}
@@ -7623,6 +7704,258 @@ qexec_init_next_partition (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec)
   return S_SUCCESS;
 }
 
+/*
+ * qexec_is_spec_attr_value () - check if a regu variable is the value of an
+ *                               attribute fetched by an access spec
+ *   return: true if it is
+ *   spec(in): access spec
+ *   attr_id(in): attribute id
+ *   regu(in): regu variable
+ */
+static bool
+qexec_is_spec_attr_value (ACCESS_SPEC_TYPE * spec, ATTR_ID attr_id, REGU_VARIABLE * regu)
+{
+  REGU_VARIABLE_LIST regu_lists[3], regu_list;
+  int i;
+
+  if (regu == NULL || regu->type != TYPE_CONSTANT || regu->xasl != NULL || regu->value.dbvalptr == NULL)
+    {
+      return false;
+    }
+
+  regu_lists[0] = spec->s.cls_node.cls_regu_list_key;
+  regu_lists[1] = spec->s.cls_node.cls_regu_list_pred;
+  regu_lists[2] = spec->s.cls_node.cls_regu_list_rest;
+  for (i = 0; i < 3; i++)
+    {
+      for (regu_list = regu_lists[i]; regu_list != NULL; regu_list = regu_list->next)
+	{
+	  if (regu_list->value.type == TYPE_ATTR_ID && regu_list->value.value.attr_descr.id == attr_id
+	      && regu_list->value.vfetch_to == regu->value.dbvalptr)
+	    {
+	      return true;
+	    }
+	}
+    }
+
+  return false;
+}
+
+/*
+ * qexec_is_partition_join_term () - look for inner.attr = outer.attr among
+ *                                   the AND terms of a predicate
+ *   return: true if found
+ *   pred(in): predicate of the inner spec
+ *   inner_attr_id(in): attribute of the inner spec
+ *   outer_spec(in): outer spec
+ *   outer_attr_id(in): attribute of the outer spec
+ */
+static bool
+qexec_is_partition_join_term (PRED_EXPR * pred, ATTR_ID inner_attr_id, ACCESS_SPEC_TYPE * outer_spec,
+			      ATTR_ID outer_attr_id)
+{
+  COMP_EVAL_TERM *et_comp;
+
+  if (pred == NULL)
+    {
+      return false;
+    }
+
+  if (pred->type == T_PRED && pred->pe.pred.bool_op == B_AND)
+    {
+      return (qexec_is_partition_join_term (pred->pe.pred.lhs, inner_attr_id, outer_spec, outer_attr_id)
+	      || qexec_is_partition_join_term (pred->pe.pred.rhs, inner_attr_id, outer_spec, outer_attr_id));
+    }
+
+  if (pred->type != T_EVAL_TERM || pred->pe.eval_term.et_type != T_COMP_EVAL_TERM)
+    {
+      return false;
+    }
+
+  et_comp = &pred->pe.eval_term.et.et_comp;
+  if (et_comp->rel_op != R_EQ || et_comp->lhs == NULL || et_comp->rhs == NULL)
+    {
+      return false;
+    }
+
+  if (et_comp->lhs->type == TYPE_ATTR_ID && et_comp->lhs->value.attr_descr.id == inner_attr_id)
+    {
+      return qexec_is_spec_attr_value (outer_spec, outer_attr_id, et_comp->rhs);
+    }
+  if (et_comp->rhs->type == TYPE_ATTR_ID && et_comp->rhs->value.attr_descr.id == inner_attr_id)
+    {
+      return qexec_is_spec_attr_value (outer_spec, outer_attr_id, et_comp->lhs);
+    }
+
+  return false;
+}
+
+/*
+ * qexec_is_partition_join_key () - check if every row of the inner spec
+ *                                  joined to an outer row has the same
+ *                                  partitioning key
+ *   return: true if the partitioning keys are joined by equality
+ *   inner_spec(in): inner spec
+ *   inner_attr_id(in): partitioning attribute of the inner spec
+ *   outer_spec(in): outer spec
+ *   outer_attr_id(in): partitioning attribute of the outer spec
+ *
+ * Note: the equality can be a data filter term, a key filter term or the
+ *       single equality key range of an index scan.
+ */
+static bool
+qexec_is_partition_join_key (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * inner_spec, ATTR_ID inner_attr_id,
+			     ACCESS_SPEC_TYPE * outer_spec, ATTR_ID outer_attr_id)
+{
+  KEY_INFO *key_info;
+  REGU_VARIABLE *key;
+  REGU_VARIABLE_LIST operand;
+  ATTR_ID *attr_ids = NULL;
+  int attr_cnt = 0, i;
+  bool is_join_key = false;
+
+  if (qexec_is_partition_join_term (inner_spec->where_pred, inner_attr_id, outer_spec, outer_attr_id)
+      || qexec_is_partition_join_term (inner_spec->where_key, inner_attr_id, outer_spec, outer_attr_id))
+    {
+      return true;
+    }
+
+  if (inner_spec->access != ACCESS_METHOD_INDEX || inner_spec->indexptr == NULL)
+    {
+      return false;
+    }
+
+  key_info = &inner_spec->indexptr->key_info;
+  if (key_info->key_cnt != 1 || key_info->key_ranges[0].range != EQ_NA || key_info->key_ranges[0].key1 == NULL)
+    {
+      return false;
+    }
+
+  if (heap_get_indexinfo_of_btid (thread_p, &ACCESS_SPEC_CLS_OID (inner_spec), &inner_spec->indexptr->btid, NULL,
+				  &attr_cnt, &attr_ids, NULL, NULL, NULL) != NO_ERROR)
+    {
+      er_clear ();
+      return false;
+    }
+
+  for (i = 0; i < attr_cnt; i++)
+    {
+      if (attr_ids[i] == inner_attr_id)
+	{
+	  break;
+	}
+    }
+
+  key = key_info->key_ranges[0].key1;
+  if (i < attr_cnt)
+    {
+      if (key->type == TYPE_FUNC && key->value.funcp->ftype == F_MIDXKEY)
+	{
+	  /* find the key value of the partitioning attribute */
+	  for (operand = key->value.funcp->operand; operand != NULL && i > 0; operand = operand->next, i--)
+	    ;
+	  is_join_key = (operand != NULL && qexec_is_spec_attr_value (outer_spec, outer_attr_id, &operand->value));
+	}
+      else if (i == 0)
+	{
+	  is_join_key = qexec_is_spec_attr_value (outer_spec, outer_attr_id, key);
+	}
+    }
+
+  if (attr_ids != NULL)
+    {
+      db_private_free (thread_p, attr_ids);
+    }
+
+  return is_join_key;
+}
+
+/*
+ * qexec_check_partition_wise_join () - find the scan procedures joined
+ *                                      partition-wise to their outer scan
+ *   return:
+ *   xasl(in): XASL tree block
+ *
+ * Note: an inner join of two classes partitioned alike on their
+ *       partitioning keys only joins rows of partitions at the same
+ *       position. Each scan block of a partitioned class is one partition,
+ *       so the pairs of scan blocks of other positions can be skipped.
+ *       The check is made once per XASL tree.
+ */
+static void
+qexec_check_partition_wise_join (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  XASL_NODE *xptr;
+  ACCESS_SPEC_TYPE *outer_spec, *inner_spec;
+  ATTR_ID outer_attr_id, inner_attr_id;
+  bool is_alike;
+
+  for (xptr = xasl; xptr->scan_ptr != NULL; xptr = xptr->scan_ptr)
+    {
+      outer_spec = xptr->spec_list;
+      inner_spec = xptr->scan_ptr->spec_list;
+      if (inner_spec == NULL || inner_spec->pw_join_checked)
+	{
+	  continue;
+	}
+      inner_spec->pw_join_checked = true;
+
+      if (outer_spec == NULL || outer_spec->next != NULL || inner_spec->next != NULL
+	  || outer_spec->type != TARGET_CLASS || inner_spec->type != TARGET_CLASS
+	  || outer_spec->pruning_type != DB_PARTITIONED_CLASS || inner_spec->pruning_type != DB_PARTITIONED_CLASS
+	  || inner_spec->single_fetch != QPROC_NO_SINGLE_INNER || xptr->scan_ptr->after_join_pred != NULL)
+	{
+	  /* outer joins return rows of the outer scan that join no inner partition */
+	  continue;
+	}
+
+      if (partition_is_partitioned_alike (thread_p, &ACCESS_SPEC_CLS_OID (outer_spec),
+					  &ACCESS_SPEC_CLS_OID (inner_spec), &outer_attr_id, &inner_attr_id,
+					  &is_alike) != NO_ERROR)
+	{
+	  er_clear ();
+	  continue;
+	}
+
+      if (is_alike && qexec_is_partition_join_key (thread_p, inner_spec, inner_attr_id, outer_spec, outer_attr_id))
+	{
+	  inner_spec->pw_join_spec = outer_spec;
+	}
+    }
+}
+
+/*
+ * qexec_is_partition_pair_disjoint () - check if the current scan blocks
+ *                                       are partitions that cannot join
+ *   return: true if the combination of scan blocks produces no rows
+ *   xasl(in): XASL tree block
+ */
+static bool
+qexec_is_partition_pair_disjoint (XASL_NODE * xasl)
+{
+  XASL_NODE *xptr;
+  ACCESS_SPEC_TYPE *outer_spec, *inner_spec;
+
+  for (xptr = xasl; xptr->scan_ptr != NULL; xptr = xptr->scan_ptr)
+    {
+      outer_spec = xptr->curr_spec;
+      inner_spec = xptr->scan_ptr->curr_spec;
+      if (outer_spec == NULL || inner_spec == NULL || inner_spec->pw_join_spec != outer_spec)
+	{
+	  continue;
+	}
+
+      /* the first scan block of a partitioned class is the (empty) class itself */
+      if (outer_spec->curent != NULL && inner_spec->curent != NULL
+	  && outer_spec->curent->position != inner_spec->curent->position)
+	{
+	  return true;
+	}
+    }
+
+  return false;
+}
+
 /*
  * qexec_intprt_fnc () -
  *   return: scan code
@@ -7721,11 +8054,23 @@ qexec_intprt_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_s
 	}
     }
 
+  qexec_check_partition_wise_join (thread_p, xasl);
+
   while ((xb_scan = qexec_next_scan_block_iterations (thread_p, xasl)) == S_SUCCESS)
     {
       int cte_offset_read_tuple = 0;
       int cte_curr_scan_tplno = -1;
 
+      if (xasl->scan_ptr != NULL && qexec_is_partition_pair_disjoint (xasl))
+	{
+	  /* partition-wise join; keep the outer scan blocks so that only the inner ones are moved */
+	  for (xptr = xasl; xptr->scan_ptr != NULL; xptr = xptr->scan_ptr)
+	    {
+	      xptr->curr_spec->s_id.qualified_block = true;
+	    }
+	  continue;
+	}
+
       if (xasl->max_iterations != -1)
 	{
 	  assert (xasl->curr_spec->type == TARGET_LIST);
@@ -13306,6 +13651,324 @@ qexec_clear_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
   return;
 }
 
+/*
+ * qexec_memo_hash_key () - hash function for memo cache keys
+ *   return: hash value
+ *   key(in): XASL_MEMO_KEY
+ *   ht_size(in): hash table size
+ */
+static unsigned int
+qexec_memo_hash_key (const void *key, unsigned int ht_size)
+{
+  const XASL_MEMO_KEY *ckey = (const XASL_MEMO_KEY *) key;
+
+  return mht_2str_pseudo_key (ckey->data, ckey->size) % ht_size;
+}
+
+/*
+ * qexec_memo_key_eq () - comparison function for memo cache keys
+ *   return: true if keys are equal, false otherwise
+ *   key1(in): first key
+ *   key2(in): second key
+ *
+ * Note: keys are packed with or_pack_db_value into zeroed buffers, so equal
+ *       bytes mean equal values of equal domains.
+ */
+static int
+qexec_memo_key_eq (const void *key1, const void *key2)
+{
+  const XASL_MEMO_KEY *ckey1 = (const XASL_MEMO_KEY *) key1;
+  const XASL_MEMO_KEY *ckey2 = (const XASL_MEMO_KEY *) key2;
+
+  return (ckey1->size == ckey2->size && memcmp (ckey1->data, ckey2->data, ckey1->size) == 0);
+}
+
+/*
+ * qexec_memo_free_entry () - free a memo cache entry
+ *   return: NO_ERROR
+ *   key(in): key of the entry
+ *   data(in): XASL_MEMO_ENTRY
+ *   args(in): thread entry
+ */
+static int
+qexec_memo_free_entry (const void *key, void *data, void *args)
+{
+  XASL_MEMO_ENTRY *entry = (XASL_MEMO_ENTRY *) data;
+  THREAD_ENTRY *thread_p = (THREAD_ENTRY *) args;
+  int i;
+
+  if (entry == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  if (entry->values != NULL)
+    {
+      for (i = 0; i < entry->val_cnt; i++)
+	{
+	  pr_clear_value (&entry->values[i]);
+	}
+      db_private_free (thread_p, entry->values);
+    }
+  db_private_free (thread_p, entry);
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_free_memo_cache () - free the memo cache of a correlated subquery
+ *   return:
+ *   cache(in): memo cache
+ */
+static void
+qexec_free_memo_cache (THREAD_ENTRY * thread_p, XASL_MEMO_CACHE * cache)
+{
+  if (cache->ht != NULL)
+    {
+      mht_clear (cache->ht, qexec_memo_free_entry, (void *) thread_p);
+      mht_destroy (cache->ht);
+    }
+  if (cache->key_buf != NULL)
+    {
+      db_private_free (thread_p, cache->key_buf);
+    }
+  db_private_free (thread_p, cache);
+}
+
+/*
+ * qexec_memo_pack_key () - pack the outer values read by a correlated
+ *                          subquery into the key buffer of its memo cache
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in): subquery
+ *   cache(in): memo cache
+ *   key(out): key referring the key buffer
+ */
+static int
+qexec_memo_pack_key (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_MEMO_CACHE * cache, XASL_MEMO_KEY * key)
+{
+  QPROC_DB_VALUE_LIST dbval_list;
+  char *ptr;
+  int size = 0;
+
+  for (dbval_list = xasl->memo_key_list->valp; dbval_list != NULL; dbval_list = dbval_list->next)
+    {
+      /* or_pack_db_value aligns each value */
+      size += or_db_value_size (dbval_list->val) + MAX_ALIGNMENT;
+    }
+
+  if (size > cache->key_buf_size)
+    {
+      if (cache->key_buf != NULL)
+	{
+	  db_private_free_and_init (thread_p, cache->key_buf);
+	  cache->key_buf_size = 0;
+	}
+      cache->key_buf = (char *) db_private_alloc (thread_p, size);
+      if (cache->key_buf == NULL)
+	{
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      cache->key_buf_size = size;
+    }
+
+  /* padding bytes must compare equal */
+  memset (cache->key_buf, 0, size);
+
+  ptr = cache->key_buf;
+  for (dbval_list = xasl->memo_key_list->valp; dbval_list != NULL; dbval_list = dbval_list->next)
+    {
+      ptr = or_pack_db_value (ptr, dbval_list->val);
+      if (ptr == NULL)
+	{
+	  return ER_FAILED;
+	}
+    }
+
+  key->data = cache->key_buf;
+  key->size = CAST_BUFLEN (ptr - cache->key_buf);
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_memo_save_result () - save the single tuple of a correlated subquery
+ *                             in its memo cache
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in): subquery, already executed
+ *   cache(in): memo cache
+ *   key(in): packed outer values of this execution
+ *
+ * Note: least recently used results are dropped to keep the cache within
+ *       max_subquery_cache_size.
+ */
+static int
+qexec_memo_save_result (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_MEMO_CACHE * cache, XASL_MEMO_KEY * key)
+{
+  XASL_MEMO_ENTRY *entry;
+  QPROC_DB_VALUE_LIST dbval_list;
+  UINT64 mem_limit = (UINT64) prm_get_integer_value (PRM_ID_MAX_SUBQUERY_CACHE_SIZE);
+  int size, i;
+
+  size = sizeof (XASL_MEMO_ENTRY) + key->size + xasl->single_tuple->val_cnt * sizeof (DB_VALUE);
+  for (dbval_list = xasl->single_tuple->valp; dbval_list != NULL; dbval_list = dbval_list->next)
+    {
+      size += pr_value_mem_size (dbval_list->val);
+    }
+  if ((UINT64) size > mem_limit)
+    {
+      /* result too large to memoize */
+      return NO_ERROR;
+    }
+
+  /* keep memo cache within memory limit */
+  while (cache->size + size > mem_limit && cache->ht->lru_head != NULL)
+    {
+      entry = (XASL_MEMO_ENTRY *) cache->ht->lru_head->data;
+      cache->size -= entry->size;
+      mht_rem (cache->ht, &entry->key, qexec_memo_free_entry, (void *) thread_p);
+    }
+
+  entry = (XASL_MEMO_ENTRY *) db_private_alloc (thread_p, sizeof (XASL_MEMO_ENTRY) + key->size);
+  if (entry == NULL)
+    {
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  entry->key.size = key->size;
+  entry->key.data = (char *) (entry + 1);
+  memcpy (entry->key.data, key->data, key->size);
+  entry->val_cnt = xasl->single_tuple->val_cnt;
+  entry->size = size;
+  entry->values = (DB_VALUE *) db_private_alloc (thread_p, entry->val_cnt * sizeof (DB_VALUE));
+  if (entry->values == NULL)
+    {
+      db_private_free (thread_p, entry);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  for (i = 0; i < entry->val_cnt; i++)
+    {
+      db_make_null (&entry->values[i]);
+    }
+  for (dbval_list = xasl->single_tuple->valp, i = 0; i < entry->val_cnt; dbval_list = dbval_list->next, i++)
+    {
+      if (pr_clone_value (dbval_list->val, &entry->values[i]) != NO_ERROR)
+	{
+	  qexec_memo_free_entry (NULL, entry, (void *) thread_p);
+	  return ER_FAILED;
+	}
+    }
+
+  if (mht_put_new (cache->ht, &entry->key, entry) == NULL)
+    {
+      /* the entry may have been linked before the table failed to grow */
+      if (mht_get (cache->ht, &entry->key) != entry)
+	{
+	  qexec_memo_free_entry (NULL, entry, (void *) thread_p);
+	}
+      return ER_FAILED;
+    }
+  cache->size += size;
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_execute_subquery () - execute a subquery linked to a regu variable
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in): subquery
+ *   xasl_state(in): XASL state information
+ *
+ * Note: a single tuple subquery whose correlated outer values are known
+ *       (memo_key_list) is executed once per distinct outer values; repeated
+ *       values restore the memoized single tuple instead. Memoization is
+ *       abandoned when the outer values hardly repeat.
+ */
+int
+qexec_execute_subquery (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state)
+{
+  XASL_MEMO_CACHE *cache;
+  XASL_MEMO_ENTRY *entry;
+  XASL_MEMO_KEY key;
+  QPROC_DB_VALUE_LIST dbval_list;
+  int error, i;
+
+  if (xasl->memo_key_list == NULL || !xasl->is_single_tuple || xasl->single_tuple == NULL
+      || prm_get_integer_value (PRM_ID_MAX_SUBQUERY_CACHE_SIZE) <= 0
+      || (xasl->memo_cache != NULL && xasl->memo_cache->is_disabled))
+    {
+      return qexec_execute_mainblock (thread_p, xasl, xasl_state, NULL);
+    }
+
+  if (xasl->memo_cache == NULL)
+    {
+      cache = (XASL_MEMO_CACHE *) db_private_alloc (thread_p, sizeof (XASL_MEMO_CACHE));
+      if (cache == NULL)
+	{
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      memset (cache, 0, sizeof (XASL_MEMO_CACHE));
+
+      cache->ht = mht_create ("Subquery memo cache", SUBQUERY_MEMO_DEFAULT_TABLE_SIZE, qexec_memo_hash_key,
+			      qexec_memo_key_eq);
+      if (cache->ht == NULL)
+	{
+	  db_private_free (thread_p, cache);
+	  return ER_FAILED;
+	}
+      cache->ht->build_lru_list = true;
+      xasl->memo_cache = cache;
+    }
+  cache = xasl->memo_cache;
+
+  error = qexec_memo_pack_key (thread_p, xasl, cache, &key);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  cache->lookup_cnt++;
+  entry = (XASL_MEMO_ENTRY *) mht_get (cache->ht, &key);
+  if (entry != NULL)
+    {
+      /* same outer values as a previous execution, restore its result */
+      for (dbval_list = xasl->single_tuple->valp, i = 0; i < entry->val_cnt; dbval_list = dbval_list->next, i++)
+	{
+	  pr_clear_value (dbval_list->val);
+	  if (pr_clone_value (&entry->values[i], dbval_list->val) != NO_ERROR)
+	    {
+	      return ER_FAILED;
+	    }
+	}
+      xasl->status = XASL_SUCCESS;
+      return NO_ERROR;
+    }
+
+  cache->miss_cnt++;
+  error = qexec_execute_mainblock (thread_p, xasl, xasl_state, NULL);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  /* check whether the outer values repeat often enough */
+  if (cache->lookup_cnt > SUBQUERY_MEMO_LOOKUP_THRESHOLD
+      && (float) cache->miss_cnt / cache->lookup_cnt > SUBQUERY_MEMO_MISS_THRESHOLD)
+    {
+      /* abandon memoization, no need to keep the results in memory */
+      cache->is_disabled = true;
+      mht_clear (cache->ht, qexec_memo_free_entry, (void *) thread_p);
+      cache->size = 0;
+
+#if !defined(NDEBUG)
+      er_log_debug (ARG_FILE_LINE, "subquery memoization abandoned: %d misses in %d lookups", cache->miss_cnt,
+		    cache->lookup_cnt);
+#endif
+      return NO_ERROR;
+    }
+
+  return qexec_memo_save_result (thread_p, xasl, cache, &key);
+}
+
 /*
  * qexec_execute_mainblock () -
  *   return: NO_ERROR, or ER_code
@@ -13949,7 +14612,7 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
 			  specp->grouped_scan = false;
 			}
 
-		      iscan_oid_order = xptr->iscan_oid_order;
+		      iscan_oid_order = xptr->iscan_oid_order || (specp->flags & ACCESS_SPEC_FLAG_OID_ORDER);
 
 		      /* open the scan for this access specification node */
 		      if (level == 0 && spec_level == 1)
@@ -23759,6 +24422,8 @@ qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd
   DB_VALUE ubound_val;
   REGU_VARIABLE_LIST var_list = NULL;
   TOPN_TUPLES *top_n = NULL;
+  XASL_NODE *xptr = NULL;
+  ACCESS_SPEC_TYPE *spec = NULL;
   int error = NO_ERROR, ubound = 0, count = 0;
   UINT64 estimated_size = 0, max_size = 0;
 
@@ -23903,6 +24568,30 @@ qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd
   top_n->sort_items = xasl->orderby_list;
   top_n->values_count = count;
 
+  /* Sort keys are evaluated a second time for the tuples which pass the key filter, and the other columns are not
+   * evaluated at all for the rejected ones. Only do this when skipping or repeating an evaluation is harmless. Method
+   * calls are not visible in the output list, so do not filter at all when the query calls methods. */
+  top_n->use_key_filter = true;
+  for (var_list = xasl->outptr_list->valptrp; var_list != NULL; var_list = var_list->next)
+    {
+      if (qexec_topn_regu_has_side_effects (&var_list->value))
+	{
+	  top_n->use_key_filter = false;
+	  break;
+	}
+    }
+  for (xptr = xasl; xptr != NULL && top_n->use_key_filter; xptr = xptr->scan_ptr)
+    {
+      for (spec = xptr->spec_list; spec != NULL; spec = spec->next)
+	{
+	  if (spec->type == TARGET_METHOD)
+	    {
+	      top_n->use_key_filter = false;
+	      break;
+	    }
+	}
+    }
+
   xasl->topn_items = top_n;
 
   return NO_ERROR;
@@ -24133,6 +24822,200 @@ qexec_add_tuple_to_topn (THREAD_ENTRY * thread_p, TOPN_TUPLES * topn_items, QFIL
   return TOPN_SUCCESS;
 }
 
+/*
+ * qexec_topn_regu_has_side_effects () - check if evaluating a regu variable
+ *					 may change anything besides its value
+ * return : true if the regu variable increments a serial or a counter,
+ *	    assigns a session variable or runs a subquery
+ * regu (in) : regu variable
+ *
+ * Note: Subqueries are not looked into; they are assumed to have side
+ *  effects.
+ */
+static bool
+qexec_topn_regu_has_side_effects (REGU_VARIABLE * regu)
+{
+  ARITH_TYPE *arithptr;
+  REGU_VARIABLE_LIST operand;
+
+  if (regu == NULL)
+    {
+      return false;
+    }
+
+  if (regu->xasl != NULL)
+    {
+      /* value of a subquery */
+      return true;
+    }
+
+  switch (regu->type)
+    {
+    case TYPE_LIST_ID:
+      return true;
+
+    case TYPE_INARITH:
+    case TYPE_OUTARITH:
+      arithptr = regu->value.arithptr;
+      if (arithptr == NULL)
+	{
+	  return false;
+	}
+      if (arithptr->opcode == T_NEXT_VALUE || arithptr->opcode == T_INCR || arithptr->opcode == T_DECR
+	  || arithptr->opcode == T_DEFINE_VARIABLE)
+	{
+	  return true;
+	}
+      return (qexec_topn_regu_has_side_effects (arithptr->leftptr)
+	      || qexec_topn_regu_has_side_effects (arithptr->rightptr)
+	      || qexec_topn_regu_has_side_effects (arithptr->thirdptr)
+	      || qexec_topn_pred_has_side_effects (arithptr->pred));
+
+    case TYPE_FUNC:
+      for (operand = regu->value.funcp->operand; operand != NULL; operand = operand->next)
+	{
+	  if (qexec_topn_regu_has_side_effects (&operand->value))
+	    {
+	      return true;
+	    }
+	}
+      return false;
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * qexec_topn_pred_has_side_effects () - check if evaluating a predicate may
+ *					 change anything besides its result
+ * return : true if any regu variable of the predicate has side effects
+ * pred (in) : predicate expression
+ */
+static bool
+qexec_topn_pred_has_side_effects (PRED_EXPR * pred)
+{
+  EVAL_TERM *term;
+
+  if (pred == NULL)
+    {
+      return false;
+    }
+
+  switch (pred->type)
+    {
+    case T_PRED:
+      return (qexec_topn_pred_has_side_effects (pred->pe.pred.lhs)
+	      || qexec_topn_pred_has_side_effects (pred->pe.pred.rhs));
+
+    case T_NOT_TERM:
+      return qexec_topn_pred_has_side_effects (pred->pe.not_term);
+
+    case T_EVAL_TERM:
+      term = &pred->pe.eval_term;
+      switch (term->et_type)
+	{
+	case T_COMP_EVAL_TERM:
+	  return (qexec_topn_regu_has_side_effects (term->et.et_comp.lhs)
+		  || qexec_topn_regu_has_side_effects (term->et.et_comp.rhs));
+	case T_ALSM_EVAL_TERM:
+	  return (qexec_topn_regu_has_side_effects (term->et.et_alsm.elem)
+		  || qexec_topn_regu_has_side_effects (term->et.et_alsm.elemset));
+	case T_LIKE_EVAL_TERM:
+	  return (qexec_topn_regu_has_side_effects (term->et.et_like.src)
+		  || qexec_topn_regu_has_side_effects (term->et.et_like.pattern)
+		  || qexec_topn_regu_has_side_effects (term->et.et_like.esc_char));
+	case T_RLIKE_EVAL_TERM:
+	  return (qexec_topn_regu_has_side_effects (term->et.et_rlike.src)
+		  || qexec_topn_regu_has_side_effects (term->et.et_rlike.pattern)
+		  || qexec_topn_regu_has_side_effects (term->et.et_rlike.case_sensitive));
+	default:
+	  return true;
+	}
+
+    default:
+      return true;
+    }
+}
+
+/*
+ * qexec_topn_reject_by_keys () - check a candidate tuple against the top-n
+ *				  heap using only its sort keys
+ * return : true if the tuple cannot enter the heap
+ * thread_p (in)    :
+ * topn_items (in)  : topn items
+ * outptr_list (in) : output list of the candidate tuple
+ * vd (in)	    : value descriptor
+ *
+ * Note: Once the heap holds n tuples, most candidates are rejected by the
+ *  comparison with the heap root. Evaluating only the sort key columns for
+ *  that comparison saves evaluating, sizing and possibly spilling the other
+ *  columns of tuples which would be thrown away anyway. Any evaluation error
+ *  is left to be raised by the regular tuple descriptor path.
+ */
+static bool
+qexec_topn_reject_by_keys (THREAD_ENTRY * thread_p, TOPN_TUPLES * topn_items, VALPTR_LIST * outptr_list,
+			   VAL_DESCR * vd)
+{
+  BH_CMP_RESULT res = BH_EQ;
+  SORT_LIST *key = NULL;
+  REGU_VARIABLE_LIST var_list = NULL;
+  TOPN_TUPLE *heap_max = NULL;
+  DB_VALUE *key_val = NULL;
+  int pos;
+
+  if (!topn_items->use_key_filter || !bh_is_full (topn_items->heap))
+    {
+      return false;
+    }
+
+  if (!bh_peek_max (topn_items->heap, &heap_max))
+    {
+      assert (false);
+      return false;
+    }
+  assert (heap_max != NULL);
+
+  for (key = topn_items->sort_items; key != NULL; key = key->next)
+    {
+      /* sort positions only count the columns which go to the list file */
+      pos = 0;
+      for (var_list = outptr_list->valptrp; var_list != NULL; var_list = var_list->next)
+	{
+	  if (REGU_VARIABLE_IS_FLAGED (&var_list->value, REGU_VARIABLE_HIDDEN_COLUMN))
+	    {
+	      continue;
+	    }
+	  if (pos == key->pos_descr.pos_no)
+	    {
+	      break;
+	    }
+	  pos++;
+	}
+      if (var_list == NULL)
+	{
+	  assert (false);
+	  return false;
+	}
+
+      key_val = qdata_get_dbval_from_constant_regu_variable (thread_p, &var_list->value, vd);
+      if (key_val == NULL)
+	{
+	  return false;
+	}
+
+      res = qexec_topn_cmpval (&heap_max->values[key->pos_descr.pos_no], key_val, key);
+      if (res == BH_EQ)
+	{
+	  continue;
+	}
+      /* same decision as the one taken by qexec_add_tuple_to_topn */
+      return (res == BH_LT);
+    }
+
+  return (res == BH_EQ);
+}
+
 /*
  * qexec_topn_tuples_to_list_id () - put tuples from the internal heap to the
  *				   output listfile
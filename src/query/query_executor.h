@@ -51,6 +51,7 @@ extern QFILE_LIST_ID *qexec_execute_query (THREAD_ENTRY * thread_p, XASL_NODE *
 					   const DB_VALUE * dbval_ptr, QUERY_ID query_id);
 extern int qexec_execute_mainblock (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state,
 				    UPDDEL_CLASS_INSTANCE_LOCK_INFO * p_class_instance_lock_info);
+extern int qexec_execute_subquery (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
 extern int qexec_start_mainblock_iterations (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
 extern int qexec_clear_xasl (THREAD_ENTRY * thread_p, XASL_NODE * xasl, bool is_final);
 extern int qexec_clear_pred_context (THREAD_ENTRY * thread_p, PRED_EXPR_WITH_CONTEXT * pred_filter,
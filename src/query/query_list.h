@@ -529,11 +529,14 @@ enum
 /* SORTING RELATED DEFINITIONS */
 
 /* Sorted list identifier */
+typedef struct qfile_list_hash_set QFILE_LIST_HASH_SET;
+
 typedef struct qfile_sorted_list_id QFILE_SORTED_LIST_ID;
 struct qfile_sorted_list_id
 {
   QFILE_LIST_ID *list_id;	/* List File identifier */
   int sorted;			/* Has file already been sorted? */
+  QFILE_LIST_HASH_SET *hash_set;	/* in-memory hash of the first column, built on demand for IN probes */
 };
 
 /* Sorting Scan Identifier */
@@ -67,6 +67,8 @@ extern int qdata_copy_valptr_list_to_tuple (THREAD_ENTRY * thread_p, VALPTR_LIST
 extern QPROC_TPLDESCR_STATUS qdata_generate_tuple_desc_for_valptr_list (THREAD_ENTRY * thread_p,
 									VALPTR_LIST * valptr_list, VAL_DESCR * vd,
 									QFILE_TUPLE_DESCRIPTOR * tdp);
+extern DB_VALUE *qdata_get_dbval_from_constant_regu_variable (THREAD_ENTRY * thread_p, REGU_VARIABLE * regu_var,
+							      VAL_DESCR * vd);
 extern int qdata_set_valptr_list_unbound (THREAD_ENTRY * thread_p, VALPTR_LIST * valptr_list, VAL_DESCR * vd);
 
 extern int qdata_add_dbval (DB_VALUE * dbval1, DB_VALUE * dbval2, DB_VALUE * res, TP_DOMAIN * domain);
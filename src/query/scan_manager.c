@@ -133,6 +133,32 @@ static int scan_Iscan_oid_buf_list_count = 0;
 
 #define SCAN_ISCAN_OID_BUF_LIST_DEFAULT_SIZE 10
 
+/* minimum number of tuples of a list file worth building a join filter on */
+#define SCAN_JOIN_FILTER_MIN_TUPLES 64
+
+/* filter on the join key of a list file scanned once per outer row.
+ *
+ * An inner list scan of a nested loop join whose predicate contains
+ * list_column = outer_value reads the whole list file for every outer row.
+ * The filter keeps the range and a bloom filter of the list column, so an
+ * outer value that matches no tuple ends the scan without reading the list
+ * file. */
+struct list_join_filter
+{
+  int key_pos;			/* position of the join key in the list file tuples */
+  DB_VALUE *probe_val;		/* outer value compared to the join key */
+  DB_TYPE type;			/* type of the join key */
+  DB_VALUE min_val;		/* smallest join key */
+  DB_VALUE max_val;		/* largest join key */
+  unsigned char *bits;		/* bloom filter on the join keys */
+  int bit_cnt;			/* number of bits of the bloom filter */
+  VPID first_vpid;		/* first page of the list file the filter was built from */
+  int tuple_cnt;		/* tuple count of the list file the filter was built from */
+  int scan_cnt;			/* number of scans started on the list file */
+  bool is_built;		/* true if the filter was built */
+  bool is_usable;		/* false if the list file cannot be probed through the filter */
+};
+
 static void scan_init_scan_pred (SCAN_PRED * scan_pred_p, REGU_VARIABLE_LIST regu_list, PRED_EXPR * pred_expr,
 				 PR_EVAL_FNC pr_eval_fnc);
 static void scan_init_scan_attrs (SCAN_ATTRS * scan_attrs_p, int num_attrs, ATTR_ID * attr_ids,
@@ -143,6 +169,8 @@ static int scan_init_indx_coverage (THREAD_ENTRY * thread_p, int coverage_enable
 static int scan_alloc_oid_list (BTREE_ISCAN_OID_LIST ** oid_list_p);
 static int scan_alloc_iscan_oid_buf_list (BTREE_ISCAN_OID_LIST ** oid_list);
 static void scan_free_iscan_oid_buf_list (BTREE_ISCAN_OID_LIST * oid_list);
+static bool scan_can_keep_range_oids (INDX_SCAN_ID * iscan_id, DB_BIGINT * key_limit_upper,
+				      DB_BIGINT * key_limit_lower);
 static void rop_to_range (RANGE * range, ROP_TYPE left, ROP_TYPE right);
 static void range_to_rop (ROP_TYPE * left, ROP_TYPE * rightk, RANGE range);
 static ROP_TYPE compare_val_op (DB_VALUE * val1, ROP_TYPE op1, DB_VALUE * val2, ROP_TYPE op2, int num_index_term);
@@ -180,6 +208,14 @@ static SCAN_CODE scan_next_method_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_
 static SCAN_CODE scan_handle_single_scan (THREAD_ENTRY * thread_p, SCAN_ID * s_id, QP_SCAN_FUNC next_scan);
 static SCAN_CODE scan_prev_scan_local (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static void resolve_domains_on_list_scan (LLIST_SCAN_ID * llsidp, VAL_LIST * ref_val_list);
+static bool scan_is_list_join_key (REGU_VARIABLE * regu, REGU_VARIABLE_LIST regu_list_pred, int *key_pos);
+static bool scan_is_list_outer_value (REGU_VARIABLE * regu, VAL_LIST * val_list);
+static bool scan_find_list_join_key (PRED_EXPR * pr, REGU_VARIABLE_LIST regu_list_pred, VAL_LIST * val_list,
+				     int *key_pos, DB_VALUE ** probe_val);
+static int scan_build_list_join_filter (THREAD_ENTRY * thread_p, LIST_JOIN_FILTER * filter, QFILE_LIST_ID * list_id);
+static bool scan_probe_list_join_filter (THREAD_ENTRY * thread_p, LIST_JOIN_FILTER * filter,
+					 QFILE_LIST_ID * list_id);
+static void scan_free_list_join_filter (THREAD_ENTRY * thread_p, LIST_JOIN_FILTER * filter);
 static void resolve_domain_on_regu_operand (REGU_VARIABLE * regu_var, VAL_LIST * ref_val_list,
 					    QFILE_TUPLE_VALUE_TYPE_LIST * p_type_list);
 static int scan_init_multi_range_optimization (THREAD_ENTRY * thread_p, MULTI_RANGE_OPT * multi_range_opt,
@@ -1071,6 +1107,51 @@ scan_free_iscan_oid_buf_list (BTREE_ISCAN_OID_LIST * oid_list)
   pthread_mutex_unlock (&scan_Iscan_oid_buf_list_mutex);
 }
 
+/*
+ * scan_can_keep_range_oids () - Can the OID's read for current key range be kept in buffer while the next key range
+ *				 is scanned?
+ *
+ * return	       : True if next key range OID's can be appended to OID buffer.
+ * iscan_id (in)       : Index scan identifier.
+ * key_limit_upper (in) : Upper key limit.
+ * key_limit_lower (in) : Lower key limit.
+ *
+ * NOTE: When index scan is done in OID order, the result has no key order to preserve. The OID's of several key
+ *	 ranges (R_KEYLIST and R_RANGELIST) are then gathered in the same buffer and sorted together, so heap pages are
+ *	 visited in physical order for the union of all ranges instead of once per range. The ranges are disjoint
+ *	 (duplicate keys are eliminated and ranges are merged), so no OID is gathered twice.
+ *	 Enough buffer space must remain to process at least one leaf record and one overflow page of next key.
+ */
+static bool
+scan_can_keep_range_oids (INDX_SCAN_ID * iscan_id, DB_BIGINT * key_limit_upper, DB_BIGINT * key_limit_lower)
+{
+  BTREE_ISCAN_OID_LIST *oid_list = iscan_id->oid_list;
+  int oid_cnt;
+
+  if (!iscan_id->iscan_oid_order || iscan_id->need_count_only || oid_list == NULL)
+    {
+      return false;
+    }
+  if (SCAN_IS_INDEX_COVERED (iscan_id) || SCAN_IS_INDEX_MRO (iscan_id) || SCAN_IS_INDEX_ISS (iscan_id))
+    {
+      return false;
+    }
+  if (iscan_id->indx_info->orderby_skip || iscan_id->indx_info->groupby_skip)
+    {
+      /* Key order is required. */
+      return false;
+    }
+  if (key_limit_upper != NULL || key_limit_lower != NULL)
+    {
+      /* Key limits are applied on each range. */
+      return false;
+    }
+
+  oid_cnt = oid_list->oid_cnt + iscan_id->oids_count;
+  return (oid_cnt < oid_list->max_oid_cnt
+	  && (oid_list->capacity - oid_cnt) >= (ISCAN_OID_BUFFER_MIN_CAPACITY / OR_OID_SIZE));
+}
+
 /*
  * rop_to_range () - map left/right to range operator
  *   return:
@@ -2523,6 +2604,13 @@ scan_get_index_oidset (THREAD_ENTRY * thread_p, SCAN_ID * s_id, DB_BIGINT * key_
 	    }
 	  if (iscan_id->oids_count > 0)
 	    {
+	      if (BTREE_END_OF_SCAN (bts) && scan_can_keep_range_oids (iscan_id, key_limit_upper, key_limit_lower))
+		{
+		  /* keep this range OID's in buffer and gather the next range after them */
+		  iscan_id->oid_list->oid_cnt += iscan_id->oids_count;
+		  iscan_id->oids_count = 0;
+		  continue;
+		}
 	      /* we've got some result */
 	      break;
 	    }
@@ -2643,6 +2731,13 @@ scan_get_index_oidset (THREAD_ENTRY * thread_p, SCAN_ID * s_id, DB_BIGINT * key_
 	    }
 	  if (iscan_id->oids_count > 0)
 	    {
+	      if (BTREE_END_OF_SCAN (bts) && scan_can_keep_range_oids (iscan_id, key_limit_upper, key_limit_lower))
+		{
+		  /* keep this range OID's in buffer and gather the next range after them */
+		  iscan_id->oid_list->oid_cnt += iscan_id->oids_count;
+		  iscan_id->oids_count = 0;
+		  continue;
+		}
 	      /* we've got some result */
 	      break;
 	    }
@@ -2656,6 +2751,13 @@ scan_get_index_oidset (THREAD_ENTRY * thread_p, SCAN_ID * s_id, DB_BIGINT * key_
 
     }
 
+  if (iscan_id->oid_list != NULL && iscan_id->oid_list->oid_cnt > 0)
+    {
+      /* add the OID's gathered from previous key ranges */
+      iscan_id->oids_count += iscan_id->oid_list->oid_cnt;
+      iscan_id->oid_list->oid_cnt = 0;
+    }
+
   /* When covering index is used, 'index_scan_in_oid_order' parameter is ignored. */
   if (iscan_id->oid_list != NULL && iscan_id->oid_list->oidp != NULL && iscan_id->oids_count > 1
       && iscan_id->iscan_oid_order == true && iscan_id->need_count_only == false)
@@ -2694,6 +2796,10 @@ end:
 
 exit_on_error:
   iscan_id->curr_keyno = key_cnt;	/* set as end of this scan */
+  if (iscan_id->oid_list != NULL)
+    {
+      iscan_id->oid_list->oid_cnt = 0;
+    }
 
   ret = (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
   goto end;
@@ -3611,6 +3717,8 @@ scan_open_index_node_info_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
  *   regu_list_pred(in):
  *   pr(in):
  *   regu_list_rest(in):
+ *   use_join_filter(in): true if the list file does not change while the
+ *                        scan is open, so a join filter can be built on it
  */
 int
 scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
@@ -3619,10 +3727,12 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 		     VAL_DESCR * vd,
 		     /* fields of LLIST_SCAN_ID */
 		     QFILE_LIST_ID * list_id, REGU_VARIABLE_LIST regu_list_pred, PRED_EXPR * pr,
-		     REGU_VARIABLE_LIST regu_list_rest)
+		     REGU_VARIABLE_LIST regu_list_rest, bool use_join_filter)
 {
   LLIST_SCAN_ID *llsidp;
   DB_TYPE single_node_type = DB_TYPE_NULL;
+  DB_VALUE *probe_val;
+  int key_pos;
 
   /* scan type is LIST SCAN */
   scan_id->type = S_LIST_SCAN;
@@ -3644,6 +3754,23 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   /* regulator vairable list for other than predicates */
   llsidp->rest_regu_list = regu_list_rest;
 
+  /* join filter; built on the list file once it is scanned again */
+  llsidp->join_filter = NULL;
+  if (use_join_filter && prm_get_integer_value (PRM_ID_MAX_JOIN_FILTER_SIZE) > 0
+      && scan_find_list_join_key (pr, regu_list_pred, val_list, &key_pos, &probe_val))
+    {
+      llsidp->join_filter = (LIST_JOIN_FILTER *) db_private_alloc (thread_p, sizeof (LIST_JOIN_FILTER));
+      if (llsidp->join_filter == NULL)
+	{
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      memset (llsidp->join_filter, 0, sizeof (LIST_JOIN_FILTER));
+      llsidp->join_filter->key_pos = key_pos;
+      llsidp->join_filter->probe_val = probe_val;
+      db_make_null (&llsidp->join_filter->min_val);
+      db_make_null (&llsidp->join_filter->max_val);
+    }
+
   return NO_ERROR;
 }
 
@@ -4662,6 +4789,11 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
       break;
 
     case S_LIST_SCAN:
+      if (scan_id->s.llsid.join_filter != NULL)
+	{
+	  scan_free_list_join_filter (thread_p, scan_id->s.llsid.join_filter);
+	  scan_id->s.llsid.join_filter = NULL;
+	}
       break;
 
     case S_SHOWSTMT_SCAN:
@@ -6156,6 +6288,16 @@ scan_next_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 
   resolve_domains_on_list_scan (llsidp, scan_id->val_list);
 
+  if (llsidp->join_filter != NULL && llsidp->lsid.position == S_BEFORE
+      && scan_id->qualification == QPROC_QUALIFIED)
+    {
+      /* no tuple can qualify if the outer value is not a join key */
+      if (!scan_probe_list_join_filter (thread_p, llsidp->join_filter, llsidp->list_id))
+	{
+	  return S_END;
+	}
+    }
+
   while ((qp_scan = qfile_scan_list_next (thread_p, &llsidp->lsid, &tplrec, PEEK)) == S_SUCCESS)
     {
 
@@ -6243,6 +6385,346 @@ scan_next_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   return qp_scan;
 }
 
+/*
+ * scan_is_list_join_key () - check if a predicate operand is a column of the
+ *                            scanned list file
+ *   return: true if the operand is a list file column
+ *   regu(in): predicate operand
+ *   regu_list_pred(in): columns fetched for the predicate
+ *   key_pos(out): position of the column in the list file tuples
+ */
+static bool
+scan_is_list_join_key (REGU_VARIABLE * regu, REGU_VARIABLE_LIST regu_list_pred, int *key_pos)
+{
+  REGU_VARIABLE_LIST regu_list;
+
+  if (regu->type != TYPE_CONSTANT || regu->xasl != NULL)
+    {
+      return false;
+    }
+
+  for (regu_list = regu_list_pred; regu_list != NULL; regu_list = regu_list->next)
+    {
+      if (regu_list->value.type == TYPE_POSITION && regu_list->value.vfetch_to == regu->value.dbvalptr)
+	{
+	  *key_pos = regu_list->value.value.pos_descr.pos_no;
+	  return true;
+	}
+    }
+
+  return false;
+}
+
+/*
+ * scan_is_list_outer_value () - check if a predicate operand is a value that
+ *                               stays the same during the list file scan
+ *   return: true if the operand is an outer value
+ *   regu(in): predicate operand
+ *   val_list(in): values fetched from the list file tuples
+ */
+static bool
+scan_is_list_outer_value (REGU_VARIABLE * regu, VAL_LIST * val_list)
+{
+  QPROC_DB_VALUE_LIST dbval_list;
+
+  if (regu->type != TYPE_CONSTANT || regu->xasl != NULL || regu->value.dbvalptr == NULL)
+    {
+      return false;
+    }
+
+  if (val_list != NULL)
+    {
+      for (dbval_list = val_list->valp; dbval_list != NULL; dbval_list = dbval_list->next)
+	{
+	  if (dbval_list->val == regu->value.dbvalptr)
+	    {
+	      return false;
+	    }
+	}
+    }
+
+  return true;
+}
+
+/*
+ * scan_find_list_join_key () - find a list_column = outer_value term that
+ *                              every qualified tuple must satisfy
+ *   return: true if such a term is found
+ *   pr(in): predicate of the list file scan
+ *   regu_list_pred(in): columns fetched for the predicate
+ *   val_list(in): values fetched from the list file tuples
+ *   key_pos(out): position of the list column
+ *   probe_val(out): outer value
+ *
+ * Note: only terms reached through AND operators are considered.
+ */
+static bool
+scan_find_list_join_key (PRED_EXPR * pr, REGU_VARIABLE_LIST regu_list_pred, VAL_LIST * val_list, int *key_pos,
+			 DB_VALUE ** probe_val)
+{
+  COMP_EVAL_TERM *et_comp;
+
+  if (pr == NULL)
+    {
+      return false;
+    }
+
+  if (pr->type == T_PRED && pr->pe.pred.bool_op == B_AND)
+    {
+      return (scan_find_list_join_key (pr->pe.pred.lhs, regu_list_pred, val_list, key_pos, probe_val)
+	      || scan_find_list_join_key (pr->pe.pred.rhs, regu_list_pred, val_list, key_pos, probe_val));
+    }
+
+  if (pr->type != T_EVAL_TERM || pr->pe.eval_term.et_type != T_COMP_EVAL_TERM)
+    {
+      return false;
+    }
+
+  et_comp = &pr->pe.eval_term.et.et_comp;
+  if (et_comp->rel_op != R_EQ || et_comp->lhs == NULL || et_comp->rhs == NULL)
+    {
+      return false;
+    }
+
+  if (scan_is_list_join_key (et_comp->lhs, regu_list_pred, key_pos) && scan_is_list_outer_value (et_comp->rhs, val_list))
+    {
+      *probe_val = et_comp->rhs->value.dbvalptr;
+      return true;
+    }
+  if (scan_is_list_join_key (et_comp->rhs, regu_list_pred, key_pos) && scan_is_list_outer_value (et_comp->lhs, val_list))
+    {
+      *probe_val = et_comp->lhs->value.dbvalptr;
+      return true;
+    }
+
+  return false;
+}
+
+/*
+ * scan_build_list_join_filter () - build the join filter of a list file
+ *   return: NO_ERROR, or ER_code
+ *   filter(in/out): join filter
+ *   list_id(in): list file
+ *
+ * Note: the filter is left unusable if the join key cannot be compared
+ *       exactly by its bytes, i.e. its type is not a fixed-width integer
+ *       or date/time type.
+ */
+static int
+scan_build_list_join_filter (THREAD_ENTRY * thread_p, LIST_JOIN_FILTER * filter, QFILE_LIST_ID * list_id)
+{
+  QFILE_LIST_SCAN_ID s_id;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  SCAN_CODE qp_scan;
+  TP_DOMAIN *domain;
+  OR_BUF buf;
+  DB_VALUE value;
+  unsigned int hash;
+  int byte_cnt, length;
+  char *ptr;
+
+  filter->is_built = true;
+  filter->is_usable = false;
+  VPID_COPY (&filter->first_vpid, &list_id->first_vpid);
+  filter->tuple_cnt = list_id->tuple_cnt;
+  db_make_null (&filter->min_val);
+  db_make_null (&filter->max_val);
+
+  if (list_id->tuple_cnt < SCAN_JOIN_FILTER_MIN_TUPLES || filter->key_pos < 0
+      || filter->key_pos >= list_id->type_list.type_cnt || list_id->type_list.domp == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  domain = list_id->type_list.domp[filter->key_pos];
+  if (domain == NULL || domain->type == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  switch (TP_DOMAIN_TYPE (domain))
+    {
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_SHORT:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+      break;
+    default:
+      return NO_ERROR;
+    }
+
+  /* about eight bits per tuple */
+  byte_cnt = MIN (list_id->tuple_cnt, prm_get_integer_value (PRM_ID_MAX_JOIN_FILTER_SIZE));
+  if (byte_cnt <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  if (filter->bits == NULL || filter->bit_cnt != byte_cnt * 8)
+    {
+      if (filter->bits != NULL)
+	{
+	  db_private_free_and_init (thread_p, filter->bits);
+	}
+      filter->bits = (unsigned char *) db_private_alloc (thread_p, byte_cnt);
+      if (filter->bits == NULL)
+	{
+	  filter->bit_cnt = 0;
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      filter->bit_cnt = byte_cnt * 8;
+    }
+  memset (filter->bits, 0, byte_cnt);
+
+  if (qfile_open_list_scan (list_id, &s_id) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  while ((qp_scan = qfile_scan_list_next (thread_p, &s_id, &tplrec, PEEK)) == S_SUCCESS)
+    {
+      if (qfile_locate_tuple_value (tplrec.tpl, filter->key_pos, &ptr, &length) == V_UNBOUND)
+	{
+	  /* null never joins */
+	  continue;
+	}
+
+      OR_BUF_INIT (buf, ptr, length);
+      if ((*(domain->type->data_readval)) (&buf, &value, domain, -1, true, NULL, 0) != NO_ERROR)
+	{
+	  qfile_close_scan (thread_p, &s_id);
+	  return ER_FAILED;
+	}
+
+      hash = mht_get_hash_number (filter->bit_cnt, &value);
+      filter->bits[hash / 8] |= (1 << (hash % 8));
+      hash = mht_valhash (&value, filter->bit_cnt);
+      filter->bits[hash / 8] |= (1 << (hash % 8));
+
+      /* fixed-width values, no need to clone */
+      if (DB_IS_NULL (&filter->min_val) || tp_value_compare (&value, &filter->min_val, 0, 1) == DB_LT)
+	{
+	  filter->min_val = value;
+	}
+      if (DB_IS_NULL (&filter->max_val) || tp_value_compare (&value, &filter->max_val, 0, 1) == DB_GT)
+	{
+	  filter->max_val = value;
+	}
+    }
+
+  qfile_close_scan (thread_p, &s_id);
+  if (qp_scan != S_END)
+    {
+      return ER_FAILED;
+    }
+
+  filter->type = TP_DOMAIN_TYPE (domain);
+  filter->is_usable = true;
+
+  return NO_ERROR;
+}
+
+/*
+ * scan_probe_list_join_filter () - check if the outer value may match a
+ *                                  join key of the list file
+ *   return: false if no tuple of the list file can qualify
+ *   filter(in/out): join filter
+ *   list_id(in): list file
+ *
+ * Note: the filter is built when the list file is scanned for the second
+ *       time, since a single scan gains nothing from it. It is rebuilt if
+ *       the list file was replaced.
+ */
+static bool
+scan_probe_list_join_filter (THREAD_ENTRY * thread_p, LIST_JOIN_FILTER * filter, QFILE_LIST_ID * list_id)
+{
+  DB_VALUE *probe_val = filter->probe_val;
+  unsigned int hash;
+
+  if (filter->is_built
+      && (filter->tuple_cnt != list_id->tuple_cnt || !VPID_EQ (&filter->first_vpid, &list_id->first_vpid)))
+    {
+      filter->is_built = false;
+      filter->scan_cnt = 0;
+    }
+
+  if (!filter->is_built)
+    {
+      if (++filter->scan_cnt < 2)
+	{
+	  return true;
+	}
+
+      if (scan_build_list_join_filter (thread_p, filter, list_id) != NO_ERROR)
+	{
+	  /* scan the list file instead */
+	  er_clear ();
+	  filter->is_usable = false;
+	  return true;
+	}
+    }
+
+  if (!filter->is_usable)
+    {
+      return true;
+    }
+
+  if (DB_IS_NULL (probe_val))
+    {
+      /* null never joins */
+      return false;
+    }
+
+  if (DB_VALUE_DOMAIN_TYPE (probe_val) != filter->type)
+    {
+      /* compared with coercion; let the predicate decide */
+      return true;
+    }
+
+  if (DB_IS_NULL (&filter->min_val))
+    {
+      /* no join keys */
+      return false;
+    }
+
+  if (tp_value_compare (probe_val, &filter->min_val, 0, 1) == DB_LT
+      || tp_value_compare (probe_val, &filter->max_val, 0, 1) == DB_GT)
+    {
+      return false;
+    }
+
+  hash = mht_get_hash_number (filter->bit_cnt, probe_val);
+  if (!(filter->bits[hash / 8] & (1 << (hash % 8))))
+    {
+      return false;
+    }
+  hash = mht_valhash (probe_val, filter->bit_cnt);
+  if (!(filter->bits[hash / 8] & (1 << (hash % 8))))
+    {
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * scan_free_list_join_filter () - free the join filter of a list file scan
+ *   return:
+ *   filter(in): join filter
+ */
+static void
+scan_free_list_join_filter (THREAD_ENTRY * thread_p, LIST_JOIN_FILTER * filter)
+{
+  if (filter->bits != NULL)
+    {
+      db_private_free_and_init (thread_p, filter->bits);
+    }
+  db_private_free (thread_p, filter);
+}
+
 /*
  * scan_next_value_scan () - The scan is moved to the next value scan item.
  *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
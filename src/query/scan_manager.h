@@ -219,6 +219,8 @@ struct index_node_scan_id
   REGU_VARIABLE_LIST node_info_regu_list;	/* regulator variable list */
 };
 
+typedef struct list_join_filter LIST_JOIN_FILTER;
+
 typedef struct llist_scan_id LLIST_SCAN_ID;
 struct llist_scan_id
 {
@@ -227,6 +229,7 @@ struct llist_scan_id
   SCAN_PRED scan_pred;		/* scan predicates(filters) */
   REGU_VARIABLE_LIST rest_regu_list;	/* regulator variable list */
   QFILE_TUPLE_RECORD *tplrecp;	/* tuple record pointer; output param */
+  LIST_JOIN_FILTER *join_filter;	/* filter on the join key of the list file, or NULL */
 };
 
 typedef struct showstmt_scan_id SHOWSTMT_SCAN_ID;
@@ -404,7 +407,7 @@ extern int scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 				VAL_LIST * val_list, VAL_DESCR * vd,
 				/* fields of LLIST_SCAN_ID */
 				QFILE_LIST_ID * list_id, REGU_VARIABLE_LIST regu_list_pred, PRED_EXPR * pr,
-				REGU_VARIABLE_LIST regu_list_rest);
+				REGU_VARIABLE_LIST regu_list_rest, bool use_join_filter);
 extern int scan_open_showstmt_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 				    /* fields of SCAN_ID */
 				    int grouped, QPROC_SINGLE_FETCH single_fetch, DB_VALUE * join_dbval,
@@ -1909,6 +1909,7 @@ stx_build_xasl_node (THREAD_ENTRY * thread_p, char *ptr, XASL_NODE * xasl)
   ptr = or_unpack_int (ptr, (int *) &xasl->ordbynum_flag);
 
   xasl->topn_items = NULL;
+  xasl->memo_cache = NULL;
 
   ptr = or_unpack_int (ptr, &offset);
   if (offset == 0)
@@ -1954,6 +1955,20 @@ stx_build_xasl_node (THREAD_ENTRY * thread_p, char *ptr, XASL_NODE * xasl)
 
   ptr = or_unpack_int (ptr, &xasl->is_single_tuple);
 
+  ptr = or_unpack_int (ptr, &offset);
+  if (offset == 0)
+    {
+      xasl->memo_key_list = NULL;
+    }
+  else
+    {
+      xasl->memo_key_list = stx_restore_val_list (thread_p, &xasl_unpack_info->packed_xasl[offset]);
+      if (xasl->memo_key_list == NULL)
+	{
+	  goto error;
+	}
+    }
+
   ptr = or_unpack_int (ptr, &tmp);
   xasl->option = (QUERY_OPTIONS) tmp;
 
@@ -4588,6 +4603,8 @@ stx_build_access_spec_type (THREAD_ENTRY * thread_p, char *ptr, ACCESS_SPEC_TYPE
   access_spec->parts = NULL;
   access_spec->curent = NULL;
   access_spec->pruned = false;
+  access_spec->pw_join_spec = NULL;
+  access_spec->pw_join_checked = false;
 
   access_spec->clear_value_at_clone_decache = false;
   ptr = or_unpack_int (ptr, &offset);
@@ -6104,6 +6121,7 @@ stx_build_srlist_id (THREAD_ENTRY * thread_p, char *ptr, QFILE_SORTED_LIST_ID *
   XASL_UNPACK_INFO *xasl_unpack_info = stx_get_xasl_unpack_info_ptr (thread_p);
 
   ptr = or_unpack_int (ptr, &sort_list_id->sorted);
+  sort_list_id->hash_set = NULL;
 
   ptr = or_unpack_int (ptr, &offset);
   if (offset == 0)
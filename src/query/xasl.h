@@ -158,6 +158,7 @@ typedef struct xasl_stat XASL_STATS;
 
 typedef struct topn_tuple TOPN_TUPLE;
 typedef struct topn_tuples TOPN_TUPLES;
+typedef struct xasl_memo_cache XASL_MEMO_CACHE;
 
 typedef struct aggregate_hash_value AGGREGATE_HASH_VALUE;
 typedef struct aggregate_hash_key AGGREGATE_HASH_KEY;
@@ -514,7 +515,7 @@ struct cte_proc_node
 	      if ((_x)->status == XASL_CLEARED || (_x)->status == XASL_INITIALIZED) \
 		{ \
 		  /* execute xasl query */ \
-		  if (qexec_execute_mainblock ((thread_p), _x, (v)->xasl_state, NULL) != NO_ERROR) \
+		  if (qexec_execute_subquery ((thread_p), _x, (v)->xasl_state) != NO_ERROR) \
 		    { \
 		      (_x)->status = XASL_FAILURE; \
 		    } \
@@ -732,7 +733,8 @@ typedef enum
 typedef enum
 {
   ACCESS_SPEC_FLAG_NONE = 0,
-  ACCESS_SPEC_FLAG_FOR_UPDATE = 0x01	/* used with FOR UPDATE clause. The spec that will be locked. */
+  ACCESS_SPEC_FLAG_FOR_UPDATE = 0x01,	/* used with FOR UPDATE clause. The spec that will be locked. */
+  ACCESS_SPEC_FLAG_OID_ORDER = 0x02	/* index scan estimated to fetch objects faster in OID order */
 } ACCESS_SPEC_FLAG;
 
 struct cls_spec_node
@@ -930,6 +932,7 @@ struct topn_tuples
   int values_count;		/* number of values in a tuple */
   UINT64 total_size;		/* size in bytes of stored tuples */
   UINT64 max_size;		/* maximum size which tuples may occupy */
+  bool use_key_filter;		/* reject tuples on their sort keys before evaluating the other columns */
 };
 
 struct topn_tuple
@@ -943,6 +946,7 @@ struct partition_spec_node
   OID oid;			/* class oid */
   HFID hfid;			/* class hfid */
   BTID btid;			/* index id */
+  int position;			/* position of the partition in the partitioning of the class */
   PARTITION_SPEC_TYPE *next;	/* next partition */
 };
 #endif /* defined (SERVER_MODE) || defined (SA_MODE) */
@@ -970,6 +974,8 @@ struct access_spec_node
   bool fixed_scan;		/* scan pages are kept fixed? */
   bool pruned;			/* true if partition pruning has been performed */
   bool clear_value_at_clone_decache;	/* true, if need to clear s_dbval at clone decache */
+  ACCESS_SPEC_TYPE *pw_join_spec;	/* outer spec whose partitions join only the same partitions of this spec */
+  bool pw_join_checked;		/* true if pw_join_spec was looked for */
 #endif				/* #if defined (SERVER_MODE) || defined (SA_MODE) */
 };
 
@@ -990,6 +996,7 @@ struct xasl_node
   VAL_LIST *single_tuple;	/* single tuple result */
 
   int is_single_tuple;		/* single tuple subquery? */
+  VAL_LIST *memo_key_list;	/* outer values the result of a correlated subquery depends on */
 
   QUERY_OPTIONS option;		/* UNIQUE option */
   OUTPTR_LIST *outptr_list;	/* output pointer list */
@@ -1075,6 +1082,7 @@ struct xasl_node
   XASL_STATS xasl_stats;
 
   TOPN_TUPLES *topn_items;	/* top-n tuples for orderby limit */
+  XASL_MEMO_CACHE *memo_cache;	/* single tuple results memoized by memo_key_list values */
 
   XASL_STATUS status;		/* current status */
 #endif				/* defined (SERVER_MODE) || defined (SA_MODE) */
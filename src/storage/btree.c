@@ -617,7 +617,8 @@ typedef int BTREE_PROCESS_OBJECT_FUNCTION (THREAD_ENTRY * thread_p, BTID_INT * b
 #define BTS_IS_SOFT_CAPACITY_ENOUGH(bts, count) \
   ((count) <= (BTS_IS_INDEX_COVERED (bts) \
    ? /* Covering index: use max tuples as soft limit. */ (bts)->index_scan_idp->indx_cov.max_tuples \
-   : /* Normal scan: use max_oid_cnt as soft limit. */ (bts)->index_scan_idp->oid_list->max_oid_cnt))
+   : /* Normal scan: use max_oid_cnt as soft limit. OID's already kept in buffer are subtracted. */ \
+   (bts)->index_scan_idp->oid_list->max_oid_cnt - (bts)->index_scan_idp->oid_list->oid_cnt))
 
 /* Hard capacity is the maximum number that can fit the OID buffer. It is
  * used when the number of objects in a single key does not fit the soft
@@ -631,7 +632,8 @@ typedef int BTREE_PROCESS_OBJECT_FUNCTION (THREAD_ENTRY * thread_p, BTID_INT * b
 #define BTS_IS_HARD_CAPACITY_ENOUGH(bts, count) \
   (BTS_IS_INDEX_COVERED (bts) \
    ? /* Covering index: no hard limit. */ true \
-   : /* Normal scan: use buffer capacity as hard limit. */ (count) <= (bts)->index_scan_idp->oid_list->capacity)
+   : /* Normal scan: use buffer capacity as hard limit. */ \
+   (count) <= (bts)->index_scan_idp->oid_list->capacity - (bts)->index_scan_idp->oid_list->oid_cnt)
 
 /* Save an object selected during scan into object buffer. This can only be
  * used by two types of scans:
@@ -24791,8 +24793,8 @@ btree_range_scan (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, BTREE_RANGE_SCAN_PR
 
   if (bts->index_scan_idp != NULL && bts->index_scan_idp->oid_list != NULL)
     {
-      /* Reset oid_ptr. */
-      bts->oid_ptr = bts->index_scan_idp->oid_list->oidp;
+      /* Reset oid_ptr. OID's kept in buffer from previous key ranges (oid_cnt) are not overwritten. */
+      bts->oid_ptr = bts->index_scan_idp->oid_list->oidp + bts->index_scan_idp->oid_list->oid_cnt;
     }
 
   while (!bts->end_scan && !bts->end_one_iteration)
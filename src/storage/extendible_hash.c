@@ -341,7 +341,7 @@ static int ehash_insert_to_bucket_after_create (THREAD_ENTRY * thread_p, EHID *
 						EHASH_HASH_KEY hash_key, bool is_temp, void *key,
 						OID * value_ptr, VPID * existing_ovf_vpid);
 
-static EHASH_HASH_KEY ehash_hash_string_type (char *key, char *orig_key);
+static EHASH_HASH_KEY ehash_hash_string_type (char *key);
 static EHASH_HASH_KEY ehash_hash_eight_bytes_type (char *key);
 #if defined (ENABLE_UNUSED_FUNCTION)
 static EHASH_HASH_KEY ehash_hash_four_bytes_type (char *key);
@@ -4141,7 +4141,7 @@ ehash_shrink_directory (THREAD_ENTRY * thread_p, EHID * ehid_p, int new_depth, b
 }
 
 static EHASH_HASH_KEY
-ehash_hash_string_type (char *key_p, char *original_key_p)
+ehash_hash_string_type (char *key_p)
 {
   EHASH_HASH_KEY hash_key = 0;
   char copy_psekey[12];
@@ -4153,13 +4153,13 @@ ehash_hash_string_type (char *key_p, char *original_key_p)
   char Char;
   int byte;
   char *p = NULL;
-  char *new_key_p = NULL;
 
   length = (int) strlen (key_p);
 
   if (length > 0)
     {
-      /* Eliminate any trailing space characters */
+      /* Eliminate any trailing space characters. Only the first length bytes of the key are folded below, so there
+       * is no need to copy the key into a trimmed, null terminated buffer. */
       if (char_isspace (*(char *) (key_p + length - 1)))
 	{
 	  for (p = key_p + length - 1; char_isspace (*p) && (p > key_p); p--)
@@ -4167,13 +4167,6 @@ ehash_hash_string_type (char *key_p, char *original_key_p)
 	      ;
 	    }
 	  length = (int) (p - key_p + 1);
-	  key_p = new_key_p = (char *) malloc (length + 1);	/* + 1 is for \0 */
-	  if (key_p == NULL)
-	    {
-	      return 0;
-	    }
-	  memcpy (key_p, original_key_p, length);
-	  *(char *) (key_p + length) = '\0';
 	}
 
       /* Takes the floor of division */
@@ -4197,11 +4190,6 @@ ehash_hash_string_type (char *key_p, char *original_key_p)
 	  Int = (int) *key_p++ << i;
 	  hash_key += Int;
 	}
-
-      if (new_key_p)
-	{
-	  free_and_init (new_key_p);
-	}
     }
 
   /* Copy the hash_key to an aux. area, to be further hashed into individual bytes */
@@ -4340,7 +4328,7 @@ ehash_hash (void *original_key_p, DB_TYPE key_type)
   switch (key_type)
     {
     case DB_TYPE_STRING:
-      hash_key = ehash_hash_string_type (key, (char *) original_key_p);
+      hash_key = ehash_hash_string_type (key);
       break;
 
     case DB_TYPE_OBJECT:
@@ -89,6 +89,12 @@ static int rv;
 #define HEAP_STATS_ENTRY_MHT_EST_SIZE 1000
 #define HEAP_STATS_ENTRY_FREELIST_SIZE 1000
 
+/* The best space cache is split by page into partitions, each with its own hash tables and mutex, so that threads
+ * inserting into the same heap file do not serialize on a single lock. */
+#define HEAP_STATS_BESTSPACE_PARTITIONS 16
+#define HEAP_STATS_BESTSPACE_PARTITION(vpid) \
+  (&heap_Bestspace[heap_hash_vpid ((vpid), HEAP_STATS_BESTSPACE_PARTITIONS)])
+
 /* A good space to accept insertions */
 #define HEAP_DROP_FREE_SPACE (int)(DB_PAGESIZE * 0.3)
 
@@ -305,6 +311,8 @@ struct heap_classrepr_entry
 				 * value is zero.  */
   int zone;			/* ZONE_VOID, ZONE_LRU, ZONE_FREE */
   int force_decache;
+  int recently_used;		/* Set when the entry is released while in the LRU list. The entry is given a second
+				 * chance instead of being moved to the LRU top on every release. */
 
   THREAD_ENTRY *next_wait_thrd;
   HEAP_CLASSREPR_ENTRY *hash_next;
@@ -456,6 +464,7 @@ struct heap_chnguess
   int nbytes;			/* Number of bytes in bitindex. It must be aligned to multiples of 4 bytes (integers) */
 };
 
+/* One partition of the best space cache */
 typedef struct heap_stats_bestspace_cache HEAP_STATS_BESTSPACE_CACHE;
 struct heap_stats_bestspace_cache
 {
@@ -487,8 +496,7 @@ static HEAP_CHNGUESS heap_Guesschn_area = { NULL, NULL, NULL, false, 0,
 
 static HEAP_CHNGUESS *heap_Guesschn = NULL;
 
-static HEAP_STATS_BESTSPACE_CACHE heap_Bestspace_cache_area =
-  { 0, NULL, NULL, 0, 0, 0, NULL, PTHREAD_MUTEX_INITIALIZER };
+static HEAP_STATS_BESTSPACE_CACHE heap_Bestspace_cache_area[HEAP_STATS_BESTSPACE_PARTITIONS];
 
 static HEAP_STATS_BESTSPACE_CACHE *heap_Bestspace = NULL;
 
@@ -593,6 +601,7 @@ static int heap_classrepr_dump_cache (bool simple_dump);
 
 static int heap_classrepr_entry_reset (HEAP_CLASSREPR_ENTRY * cache_entry);
 static int heap_classrepr_entry_remove_from_LRU (HEAP_CLASSREPR_ENTRY * cache_entry);
+static void heap_classrepr_entry_add_to_LRU_top (HEAP_CLASSREPR_ENTRY * cache_entry);
 static HEAP_CLASSREPR_ENTRY *heap_classrepr_entry_alloc (void);
 static int heap_classrepr_entry_free (HEAP_CLASSREPR_ENTRY * cache_entry);
 
@@ -611,6 +620,10 @@ static HEAP_FINDSPACE heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p
 							 HEAP_BESTSPACE * bestspace, int *idx_badspace,
 							 int record_length, int needed_space,
 							 HEAP_SCANCACHE * scan_cache, PGBUF_WATCHER * pg_watcher);
+static int heap_stats_find_page_in_insert_hint (THREAD_ENTRY * thread_p, const HFID * hfid, int needed_space,
+						HEAP_SCANCACHE * scan_cache, PGBUF_WATCHER * pg_watcher);
+static void heap_insert_hint_init (HEAP_INSERT_HINT * insert_hint);
+static void heap_insert_hint_flush_estimates (THREAD_ENTRY * thread_p, HEAP_INSERT_HINT * insert_hint);
 static PAGE_PTR heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int needed_space, bool isnew_rec,
 					   int newrec_size, HEAP_SCANCACHE * space_cache, PGBUF_WATCHER * pg_watcher);
 static int heap_stats_sync_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr,
@@ -924,30 +937,33 @@ heap_compare_hfid (const void *key_hfid1, const void *key_hfid2)
  * heap_stats_entry_free () - release all memory occupied by an best space
  *   return:  NO_ERROR
  *   data(in): a best space associated with the key
- *   args(in): NULL (not used here, but needed by mht_map)
+ *   args(in): the best space cache partition the entry belongs to
  */
 static int
 heap_stats_entry_free (THREAD_ENTRY * thread_p, void *data, void *args)
 {
   HEAP_STATS_ENTRY *ent;
+  HEAP_STATS_BESTSPACE_CACHE *part;
 
   ent = (HEAP_STATS_ENTRY *) data;
+  part = (HEAP_STATS_BESTSPACE_CACHE *) args;
   assert_release (ent != NULL);
+  assert (part != NULL);
 
   if (ent)
     {
-      if (heap_Bestspace->free_list_count < HEAP_STATS_ENTRY_FREELIST_SIZE)
+      if (part->free_list_count < HEAP_STATS_ENTRY_FREELIST_SIZE / HEAP_STATS_BESTSPACE_PARTITIONS)
 	{
-	  ent->next = heap_Bestspace->free_list;
-	  heap_Bestspace->free_list = ent;
+	  ent->next = part->free_list;
+	  part->free_list = ent;
 
-	  heap_Bestspace->free_list_count++;
+	  part->free_list_count++;
 	}
       else
 	{
 	  free_and_init (ent);
 
-	  heap_Bestspace->num_free++;
+	  part->num_free++;
 	}
     }
 
@@ -960,14 +976,25 @@ heap_stats_entry_free (THREAD_ENTRY * thread_p, void *data, void *args)
 static HEAP_STATS_ENTRY *
 heap_stats_add_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * vpid, int freespace)
 {
+  HEAP_STATS_BESTSPACE_CACHE *part;
   HEAP_STATS_ENTRY *ent;
+  int max_entries;
   int rc;
 
   assert (prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES) > 0);
 
-  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
+  part = HEAP_STATS_BESTSPACE_PARTITION (vpid);
+
+  /* the maximum number of entries is shared evenly by the partitions */
+  max_entries = prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES) / HEAP_STATS_BESTSPACE_PARTITIONS;
+  if (max_entries < 1)
+    {
+      max_entries = 1;
+    }
+
+  rc = pthread_mutex_lock (&part->bestspace_mutex);
 
-  ent = (HEAP_STATS_ENTRY *) mht_get (heap_Bestspace->vpid_ht, vpid);
+  ent = (HEAP_STATS_ENTRY *) mht_get (part->vpid_ht, vpid);
 
   if (ent)
     {
@@ -975,7 +1002,7 @@ heap_stats_add_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * vpi
       goto end;
     }
 
-  if (heap_Bestspace->num_stats_entries >= prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES))
+  if (part->num_stats_entries >= max_entries)
     {
       er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_HF_MAX_BESTSPACE_ENTRIES, 1,
 	      prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES));
@@ -987,19 +1014,19 @@ heap_stats_add_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * vpi
       goto end;
     }
 
-  if (heap_Bestspace->free_list_count > 0)
+  if (part->free_list_count > 0)
     {
-      assert_release (heap_Bestspace->free_list != NULL);
+      assert_release (part->free_list != NULL);
 
-      ent = heap_Bestspace->free_list;
+      ent = part->free_list;
       if (ent == NULL)
 	{
 	  goto end;
 	}
-      heap_Bestspace->free_list = ent->next;
+      part->free_list = ent->next;
       ent->next = NULL;
 
-      heap_Bestspace->free_list_count--;
+      part->free_list_count--;
     }
   else
     {
@@ -1011,7 +1038,7 @@ heap_stats_add_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * vpi
 	  goto end;
 	}
 
-      heap_Bestspace->num_alloc++;
+      part->num_alloc++;
     }
 
   HFID_COPY (&ent->hfid, hfid);
@@ -1019,30 +1046,30 @@ heap_stats_add_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * vpi
   ent->best.freespace = freespace;
   ent->next = NULL;
 
-  if (mht_put (heap_Bestspace->vpid_ht, &ent->best.vpid, ent) == NULL)
+  if (mht_put (part->vpid_ht, &ent->best.vpid, ent) == NULL)
     {
       assert_release (false);
-      (void) heap_stats_entry_free (thread_p, ent, NULL);
+      (void) heap_stats_entry_free (thread_p, ent, part);
       ent = NULL;
       goto end;
     }
 
-  if (mht_put_new (heap_Bestspace->hfid_ht, &ent->hfid, ent) == NULL)
+  if (mht_put_new (part->hfid_ht, &ent->hfid, ent) == NULL)
     {
       assert_release (false);
-      (void) mht_rem (heap_Bestspace->vpid_ht, &ent->best.vpid, NULL, NULL);
-      (void) heap_stats_entry_free (thread_p, ent, NULL);
+      (void) mht_rem (part->vpid_ht, &ent->best.vpid, NULL, NULL);
+      (void) heap_stats_entry_free (thread_p, ent, part);
       ent = NULL;
       goto end;
     }
 
-  heap_Bestspace->num_stats_entries++;
+  part->num_stats_entries++;
 
 end:
 
-  assert (mht_count (heap_Bestspace->vpid_ht) == mht_count (heap_Bestspace->hfid_ht));
+  assert (mht_count (part->vpid_ht) == mht_count (part->hfid_ht));
 
-  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+  pthread_mutex_unlock (&part->bestspace_mutex);
 
   return ent;
 }
@@ -1056,28 +1083,38 @@ end:
 static int
 heap_stats_del_bestspace_by_hfid (THREAD_ENTRY * thread_p, const HFID * hfid)
 {
+  HEAP_STATS_BESTSPACE_CACHE *part;
   HEAP_STATS_ENTRY *ent;
-  int del_cnt = 0;
+  int del_cnt = 0, part_del_cnt;
+  int i;
   int rc;
 
-  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
-
-  while ((ent = (HEAP_STATS_ENTRY *) mht_get2 (heap_Bestspace->hfid_ht, hfid, NULL)) != NULL)
+  /* the pages of a heap file are spread over all partitions */
+  for (i = 0; i < HEAP_STATS_BESTSPACE_PARTITIONS; i++)
     {
-      (void) mht_rem2 (heap_Bestspace->hfid_ht, &ent->hfid, ent, NULL, NULL);
-      (void) mht_rem (heap_Bestspace->vpid_ht, &ent->best.vpid, NULL, NULL);
-      (void) heap_stats_entry_free (thread_p, ent, NULL);
-      ent = NULL;
+      part = &heap_Bestspace[i];
+      part_del_cnt = 0;
 
-      del_cnt++;
-    }
+      rc = pthread_mutex_lock (&part->bestspace_mutex);
 
-  assert (del_cnt <= heap_Bestspace->num_stats_entries);
+      while ((ent = (HEAP_STATS_ENTRY *) mht_get2 (part->hfid_ht, hfid, NULL)) != NULL)
+	{
+	  (void) mht_rem2 (part->hfid_ht, &ent->hfid, ent, NULL, NULL);
+	  (void) mht_rem (part->vpid_ht, &ent->best.vpid, NULL, NULL);
+	  (void) heap_stats_entry_free (thread_p, ent, part);
+	  ent = NULL;
 
-  heap_Bestspace->num_stats_entries -= del_cnt;
+	  part_del_cnt++;
+	}
 
-  assert (mht_count (heap_Bestspace->vpid_ht) == mht_count (heap_Bestspace->hfid_ht));
-  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+      assert (part_del_cnt <= part->num_stats_entries);
+
+      part->num_stats_entries -= part_del_cnt;
+      del_cnt += part_del_cnt;
+
+      assert (mht_count (part->vpid_ht) == mht_count (part->hfid_ht));
+      pthread_mutex_unlock (&part->bestspace_mutex);
+    }
 
   return del_cnt;
 }
@@ -1091,28 +1128,31 @@ heap_stats_del_bestspace_by_hfid (THREAD_ENTRY * thread_p, const HFID * hfid)
 static int
 heap_stats_del_bestspace_by_vpid (THREAD_ENTRY * thread_p, VPID * vpid)
 {
+  HEAP_STATS_BESTSPACE_CACHE *part;
   HEAP_STATS_ENTRY *ent;
   int rc;
 
-  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
+  part = HEAP_STATS_BESTSPACE_PARTITION (vpid);
 
-  ent = (HEAP_STATS_ENTRY *) mht_get (heap_Bestspace->vpid_ht, vpid);
+  rc = pthread_mutex_lock (&part->bestspace_mutex);
+
+  ent = (HEAP_STATS_ENTRY *) mht_get (part->vpid_ht, vpid);
   if (ent == NULL)
     {
       goto end;
     }
 
-  (void) mht_rem2 (heap_Bestspace->hfid_ht, &ent->hfid, ent, NULL, NULL);
-  (void) mht_rem (heap_Bestspace->vpid_ht, &ent->best.vpid, NULL, NULL);
-  (void) heap_stats_entry_free (thread_p, ent, NULL);
+  (void) mht_rem2 (part->hfid_ht, &ent->hfid, ent, NULL, NULL);
+  (void) mht_rem (part->vpid_ht, &ent->best.vpid, NULL, NULL);
+  (void) heap_stats_entry_free (thread_p, ent, part);
   ent = NULL;
 
-  heap_Bestspace->num_stats_entries -= 1;
+  part->num_stats_entries -= 1;
 
 end:
-  assert (mht_count (heap_Bestspace->vpid_ht) == mht_count (heap_Bestspace->hfid_ht));
+  assert (mht_count (part->vpid_ht) == mht_count (part->hfid_ht));
 
-  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+  pthread_mutex_unlock (&part->bestspace_mutex);
 
   return NO_ERROR;
 }
@@ -1126,6 +1166,7 @@ end:
 static HEAP_BESTSPACE
 heap_stats_get_bestspace_by_vpid (THREAD_ENTRY * thread_p, VPID * vpid)
 {
+  HEAP_STATS_BESTSPACE_CACHE *part;
   HEAP_STATS_ENTRY *ent;
   HEAP_BESTSPACE best;
   int rc;
@@ -1133,9 +1174,11 @@ heap_stats_get_bestspace_by_vpid (THREAD_ENTRY * thread_p, VPID * vpid)
   best.freespace = -1;
   VPID_SET_NULL (&best.vpid);
 
-  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
+  part = HEAP_STATS_BESTSPACE_PARTITION (vpid);
+
+  rc = pthread_mutex_lock (&part->bestspace_mutex);
 
-  ent = (HEAP_STATS_ENTRY *) mht_get (heap_Bestspace->vpid_ht, vpid);
+  ent = (HEAP_STATS_ENTRY *) mht_get (part->vpid_ht, vpid);
   if (ent == NULL)
     {
       goto end;
@@ -1144,9 +1187,9 @@ heap_stats_get_bestspace_by_vpid (THREAD_ENTRY * thread_p, VPID * vpid)
   best = ent->best;
 
 end:
-  assert (mht_count (heap_Bestspace->vpid_ht) == mht_count (heap_Bestspace->hfid_ht));
+  assert (mht_count (part->vpid_ht) == mht_count (part->hfid_ht));
 
-  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+  pthread_mutex_unlock (&part->bestspace_mutex);
 
   return best;
 }
@@ -1337,6 +1380,7 @@ heap_classrepr_initialize_cache (void)
       cache_entry[i].next = (i < heap_Classrepr_cache.num_entries - 1) ? &cache_entry[i + 1] : NULL;
 
       cache_entry[i].force_decache = false;
+      cache_entry[i].recently_used = false;
 
       OID_SET_NULL (&cache_entry[i].class_oid);
       cache_entry[i].max_reprid = DEFAULT_REPR_INCREMENT;
@@ -1527,6 +1571,7 @@ heap_classrepr_entry_reset (HEAP_CLASSREPR_ENTRY * cache_entry)
     }
 
   cache_entry->force_decache = false;
+  cache_entry->recently_used = false;
   OID_SET_NULL (&cache_entry->class_oid);
   if (cache_entry->max_reprid > DEFAULT_REPR_INCREMENT)
     {
@@ -1585,6 +1630,31 @@ heap_classrepr_entry_remove_from_LRU (HEAP_CLASSREPR_ENTRY * cache_entry)
   return NO_ERROR;
 }
 
+/*
+ * heap_classrepr_entry_add_to_LRU_top () -
+ *   return: void
+ *   cache_entry(in):
+ *
+ * Note: The caller must hold the LRU mutex.
+ */
+static void
+heap_classrepr_entry_add_to_LRU_top (HEAP_CLASSREPR_ENTRY * cache_entry)
+{
+  cache_entry->prev = NULL;
+  cache_entry->next = heap_Classrepr_cache.LRU_list.LRU_top;
+  if (heap_Classrepr_cache.LRU_list.LRU_top == NULL)
+    {
+      heap_Classrepr_cache.LRU_list.LRU_bottom = cache_entry;
+    }
+  else
+    {
+      heap_Classrepr_cache.LRU_list.LRU_top->prev = cache_entry;
+    }
+  heap_Classrepr_cache.LRU_list.LRU_top = cache_entry;
+  cache_entry->zone = ZONE_LRU;
+  cache_entry->recently_used = false;
+}
+
 /* TODO: STL::list for ->prev */
 /*
  * heap_classrepr_decache_guessed_last () -
@@ -1818,34 +1888,25 @@ heap_classrepr_free (OR_CLASSREP * classrep, int *idx_incache)
 	      ret = heap_classrepr_entry_reset (cache_entry);
 	    }
 	}
+      else if (cache_entry->zone == ZONE_LRU)
+	{
+	  /* Hot classes are released all the time. Instead of relocating the entry to the LRU top, which needs the
+	   * global LRU mutex, just mark it; the victim search gives it a second chance. */
+	  cache_entry->recently_used = true;
+	}
       else
 	{
-	  /* relocate entry to the top of LRU list */
-	  if (cache_entry != heap_Classrepr_cache.LRU_list.LRU_top)
+	  /* insert into LRU top */
+	  rv = pthread_mutex_lock (&heap_Classrepr_cache.LRU_list.LRU_mutex);
+	  if (cache_entry->zone != ZONE_LRU)
 	    {
-	      rv = pthread_mutex_lock (&heap_Classrepr_cache.LRU_list.LRU_mutex);
-	      if (cache_entry->zone == ZONE_LRU)
-		{
-		  /* remove from LRU list */
-		  (void) heap_classrepr_entry_remove_from_LRU (cache_entry);
-		}
-
-	      /* insert into LRU top */
-	      cache_entry->prev = NULL;
-	      cache_entry->next = heap_Classrepr_cache.LRU_list.LRU_top;
-	      if (heap_Classrepr_cache.LRU_list.LRU_top == NULL)
-		{
-		  heap_Classrepr_cache.LRU_list.LRU_bottom = cache_entry;
-		}
-	      else
-		{
-		  heap_Classrepr_cache.LRU_list.LRU_top->prev = cache_entry;
-		}
-	      heap_Classrepr_cache.LRU_list.LRU_top = cache_entry;
-	      cache_entry->zone = ZONE_LRU;
-
-	      pthread_mutex_unlock (&heap_Classrepr_cache.LRU_list.LRU_mutex);
+	      heap_classrepr_entry_add_to_LRU_top (cache_entry);
 	    }
+	  else
+	    {
+	      cache_entry->recently_used = true;
+	    }
+	  pthread_mutex_unlock (&heap_Classrepr_cache.LRU_list.LRU_mutex);
 	}
     }
   pthread_mutex_unlock (&cache_entry->mutex);
@@ -1989,6 +2050,7 @@ heap_classrepr_entry_alloc (void)
 {
   HEAP_CLASSREPR_HASH *hash_anchor;
   HEAP_CLASSREPR_ENTRY *cache_entry, *prev_entry, *cur_entry;
+  int num_scanned;
   int rv;
 
   cache_entry = NULL;
@@ -2029,16 +2091,37 @@ check_LRU_list:
     }
 
   rv = pthread_mutex_lock (&heap_Classrepr_cache.LRU_list.LRU_mutex);
-  for (cache_entry = heap_Classrepr_cache.LRU_list.LRU_bottom; cache_entry != NULL; cache_entry = cache_entry->prev)
+  num_scanned = 0;
+  cache_entry = heap_Classrepr_cache.LRU_list.LRU_bottom;
+  while (cache_entry != NULL)
     {
+      prev_entry = cache_entry->prev;
+      num_scanned++;
+
       if (cache_entry->fcnt == 0)
 	{
-	  /* remove from LRU list */
-	  (void) heap_classrepr_entry_remove_from_LRU (cache_entry);
-	  cache_entry->zone = ZONE_VOID;
-	  cache_entry->next = cache_entry->prev = NULL;
-	  break;
+	  if (cache_entry->recently_used && num_scanned <= heap_Classrepr_cache.num_entries)
+	    {
+	      /* second chance: the entry was used since it was last looked at, move it to the LRU top */
+	      (void) heap_classrepr_entry_remove_from_LRU (cache_entry);
+	      heap_classrepr_entry_add_to_LRU_top (cache_entry);
+	      if (prev_entry == NULL)
+		{
+		  /* it was already the top; look at it once more */
+		  prev_entry = cache_entry;
+		}
+	    }
+	  else
+	    {
+	      /* remove from LRU list */
+	      (void) heap_classrepr_entry_remove_from_LRU (cache_entry);
+	      cache_entry->zone = ZONE_VOID;
+	      cache_entry->next = cache_entry->prev = NULL;
+	      break;
+	    }
 	}
+
+      cache_entry = prev_entry;
     }
   pthread_mutex_unlock (&heap_Classrepr_cache.LRU_list.LRU_mutex);
 
@@ -3133,11 +3216,13 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
   HEAP_FINDSPACE found;
   int old_wait_msecs;
   int notfound_cnt;
+  HEAP_STATS_BESTSPACE_CACHE *part;
   HEAP_STATS_ENTRY *ent;
   HEAP_BESTSPACE best;
   int rc;
   int idx_worstspace;
   int i, best_array_index = -1;
+  int part_idx, part_cnt;
   bool hash_is_available;
   bool best_hint_is_used;
 
@@ -3157,17 +3242,24 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
   best_array_index = 0;
   hash_is_available = prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES) > 0;
 
+  /* Each thread starts looking in a different partition, so that concurrent inserters pick different pages instead
+   * of all competing for the latch of the same one. */
+  part_idx = THREAD_GET_CURRENT_ENTRY_INDEX (thread_p) % HEAP_STATS_BESTSPACE_PARTITIONS;
+
   while (found == HEAP_FINDSPACE_NOTFOUND)
     {
       best.freespace = -1;	/* init */
       best_hint_is_used = false;
 
-      if (hash_is_available)
+      for (part_cnt = 0; hash_is_available && best.freespace == -1 && part_cnt < HEAP_STATS_BESTSPACE_PARTITIONS;
+	   part_cnt++)
 	{
-	  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
+	  part = &heap_Bestspace[part_idx];
+
+	  rc = pthread_mutex_lock (&part->bestspace_mutex);
 
 	  while (notfound_cnt < BEST_PAGE_SEARCH_MAX_COUNT
-		 && (ent = (HEAP_STATS_ENTRY *) mht_get2 (heap_Bestspace->hfid_ht, hfid, NULL)) != NULL)
+		 && (ent = (HEAP_STATS_ENTRY *) mht_get2 (part->hfid_ht, hfid, NULL)) != NULL)
 	    {
 	      if (ent->best.freespace >= needed_space)
 		{
@@ -3177,17 +3269,22 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
 		}
 
 	      /* remove in memory bestspace */
-	      (void) mht_rem2 (heap_Bestspace->hfid_ht, &ent->hfid, ent, NULL, NULL);
-	      (void) mht_rem (heap_Bestspace->vpid_ht, &ent->best.vpid, NULL, NULL);
-	      (void) heap_stats_entry_free (thread_p, ent, NULL);
+	      (void) mht_rem2 (part->hfid_ht, &ent->hfid, ent, NULL, NULL);
+	      (void) mht_rem (part->vpid_ht, &ent->best.vpid, NULL, NULL);
+	      (void) heap_stats_entry_free (thread_p, ent, part);
 	      ent = NULL;
 
-	      heap_Bestspace->num_stats_entries--;
+	      part->num_stats_entries--;
 
 	      notfound_cnt++;
 	    }
 
-	  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+	  pthread_mutex_unlock (&part->bestspace_mutex);
+
+	  if (best.freespace == -1)
+	    {
+	      part_idx = (part_idx + 1) % HEAP_STATS_BESTSPACE_PARTITIONS;
+	    }
 	}
 
       if (best.freespace == -1)
@@ -3312,6 +3409,9 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
 	  else
 	    {
 	      notfound_cnt++;
+
+	      /* the page may be latched by another inserter; look in the next partition first */
+	      part_idx = (part_idx + 1) % HEAP_STATS_BESTSPACE_PARTITIONS;
 	    }
 	}
     }
@@ -3347,6 +3447,152 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
   return found;
 }
 
+/*
+ * heap_stats_find_page_in_insert_hint () - Try the page of the last insert of the scan cache
+ *   return: error code or NO_ERROR
+ *   hfid(in): Object heap file identifier
+ *   needed_space(in): The minimal space needed
+ *   scan_cache(in/out): Scan cache
+ *   pg_watcher(out): Watcher of the page, not fixed if the page cannot be used
+ *
+ * Note: Consecutive inserts through the same scan cache (INSERT ... SELECT, loaddb) fill the same page until it is
+ *       full. Using it directly avoids latching the heap header page exclusively and searching the best space
+ *       statistics for each record. The page is not waited for; a busy, full, deallocated or reused page just sends
+ *       the caller to the regular search.
+ */
+static int
+heap_stats_find_page_in_insert_hint (THREAD_ENTRY * thread_p, const HFID * hfid, int needed_space,
+				     HEAP_SCANCACHE * scan_cache, PGBUF_WATCHER * pg_watcher)
+{
+  HEAP_INSERT_HINT *insert_hint = &scan_cache->insert_hint;
+  HEAP_CHAIN *chain;
+  RECDES chain_recdes;
+  int total_space;
+  int old_wait_msecs;
+  bool can_use = false;
+
+  assert (PGBUF_IS_CLEAN_WATCHER (pg_watcher));
+
+  if (VPID_ISNULL (&insert_hint->vpid) || !HFID_EQ (&insert_hint->hfid, hfid))
+    {
+      return NO_ERROR;
+    }
+
+  total_space = needed_space + heap_Slotted_overhead + insert_hint->unfill_space;
+  if (heap_is_big_length (total_space))
+    {
+      total_space = needed_space + heap_Slotted_overhead;
+    }
+
+  old_wait_msecs = xlogtb_reset_wait_msecs (thread_p, LK_FORCE_ZERO_WAIT);
+  (void) pgbuf_ordered_fix (thread_p, &insert_hint->vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_WRITE, pg_watcher);
+  (void) xlogtb_reset_wait_msecs (thread_p, old_wait_msecs);
+
+  if (pg_watcher->pgptr == NULL)
+    {
+      if (er_errid () == ER_INTERRUPTED)
+	{
+	  return ER_INTERRUPTED;
+	}
+      /* page is busy or could not be fixed; forget it */
+      er_clear ();
+      VPID_SET_NULL (&insert_hint->vpid);
+      return NO_ERROR;
+    }
+
+  /* the page may have been deallocated or reused by another file since the last insert */
+  if (pgbuf_check_page_type_no_error (thread_p, pg_watcher->pgptr, PAGE_HEAP)
+      && spage_get_record (thread_p, pg_watcher->pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &chain_recdes,
+			   PEEK) == S_SUCCESS && chain_recdes.length == sizeof (HEAP_CHAIN))
+    {
+      chain = (HEAP_CHAIN *) chain_recdes.data;
+      can_use = (OID_EQ (&chain->class_oid, &insert_hint->class_oid)
+		 && spage_max_space_for_new_record (thread_p, pg_watcher->pgptr) >= total_space);
+    }
+
+  if (!can_use)
+    {
+      pgbuf_ordered_unfix (thread_p, pg_watcher);
+      VPID_SET_NULL (&insert_hint->vpid);
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * heap_insert_hint_init () - Initialize the insert hint of a scan cache
+ *   return: void
+ *   insert_hint(out): Insert hint
+ */
+static void
+heap_insert_hint_init (HEAP_INSERT_HINT * insert_hint)
+{
+  HFID_SET_NULL (&insert_hint->hfid);
+  VPID_SET_NULL (&insert_hint->vpid);
+  OID_SET_NULL (&insert_hint->class_oid);
+  insert_hint->unfill_space = 0;
+  insert_hint->num_recs = 0;
+  insert_hint->recs_sumlen = 0.0;
+}
+
+/*
+ * heap_insert_hint_flush_estimates () - Add the estimates of the inserts done in the hinted page to the heap header
+ *   return: void
+ *   insert_hint(in/out): Insert hint
+ *
+ * Note: Estimates are not logged. They are dropped if the header page cannot be fixed or an error is pending.
+ */
+static void
+heap_insert_hint_flush_estimates (THREAD_ENTRY * thread_p, HEAP_INSERT_HINT * insert_hint)
+{
+  VPID vpid;
+  LOG_DATA_ADDR addr_hdr;
+  RECDES hdr_recdes;
+  HEAP_HDR_STATS *heap_hdr;
+  PGBUF_WATCHER hdr_page_watcher;
+
+  if (insert_hint->num_recs == 0 && insert_hint->recs_sumlen == 0.0)
+    {
+      return;
+    }
+
+  if (er_errid () == NO_ERROR && !HFID_IS_NULL (&insert_hint->hfid))
+    {
+      PGBUF_INIT_WATCHER (&hdr_page_watcher, PGBUF_ORDERED_HEAP_HDR, &insert_hint->hfid);
+      vpid.volid = insert_hint->hfid.vfid.volid;
+      vpid.pageid = insert_hint->hfid.hpgid;
+
+      if (pgbuf_ordered_fix (thread_p, &vpid, OLD_PAGE, PGBUF_LATCH_WRITE, &hdr_page_watcher) != NO_ERROR)
+	{
+	  er_clear ();
+	}
+      else
+	{
+	  if (spage_get_record (thread_p, hdr_page_watcher.pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &hdr_recdes, PEEK)
+	      == S_SUCCESS)
+	    {
+	      heap_hdr = (HEAP_HDR_STATS *) hdr_recdes.data;
+	      heap_hdr->estimates.num_recs += insert_hint->num_recs;
+	      heap_hdr->estimates.recs_sumlen += insert_hint->recs_sumlen;
+
+	      addr_hdr.vfid = &insert_hint->hfid.vfid;
+	      addr_hdr.offset = HEAP_HEADER_AND_CHAIN_SLOTID;
+	      addr_hdr.pgptr = hdr_page_watcher.pgptr;
+	      log_skip_logging (thread_p, &addr_hdr);
+	      pgbuf_ordered_set_dirty_and_free (thread_p, &hdr_page_watcher);
+	    }
+	  else
+	    {
+	      assert (false);
+	      pgbuf_ordered_unfix (thread_p, &hdr_page_watcher);
+	    }
+	}
+    }
+
+  insert_hint->num_recs = 0;
+  insert_hint->recs_sumlen = 0.0;
+}
+
 /*
  * heap_stats_find_best_page () - Find a page with the needed space.
  *   return: pointer to page with enough space or NULL
@@ -3384,6 +3630,23 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
    */
 
   assert (scan_cache == NULL || scan_cache->cache_last_fix_page == false || scan_cache->page_watcher.pgptr == NULL);
+
+  if (scan_cache != NULL && isnew_rec == true && newrec_size <= DB_PAGESIZE)
+    {
+      if (heap_stats_find_page_in_insert_hint (thread_p, hfid, needed_space, scan_cache, pg_watcher) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return NULL;
+	}
+      if (pg_watcher->pgptr != NULL)
+	{
+	  /* header estimates are updated later, see heap_insert_hint_flush_estimates */
+	  scan_cache->insert_hint.num_recs += 1;
+	  scan_cache->insert_hint.recs_sumlen += (float) newrec_size;
+	  return pg_watcher->pgptr;
+	}
+    }
+
   PGBUF_INIT_WATCHER (&hdr_page_watcher, PGBUF_ORDERED_HEAP_HDR, hfid);
 
   /* 
@@ -3421,6 +3684,15 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
 
   heap_hdr = (HEAP_HDR_STATS *) hdr_recdes.data;
 
+  if (scan_cache != NULL && HFID_EQ (&scan_cache->insert_hint.hfid, hfid))
+    {
+      /* header is fixed anyway; add the estimates of previous inserts in the hinted page */
+      heap_hdr->estimates.num_recs += scan_cache->insert_hint.num_recs;
+      heap_hdr->estimates.recs_sumlen += scan_cache->insert_hint.recs_sumlen;
+      scan_cache->insert_hint.num_recs = 0;
+      scan_cache->insert_hint.recs_sumlen = 0.0;
+    }
+
   if (isnew_rec == true)
     {
       heap_hdr->estimates.num_recs += 1;
@@ -3536,6 +3808,23 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
 	      || er_errid () == ER_FILE_NOT_ENOUGH_PAGES_IN_DATABASE);
     }
 
+  if (scan_cache != NULL && isnew_rec == true && pg_watcher->pgptr != NULL
+      && (scan_cache->insert_hint.num_recs == 0 || HFID_EQ (&scan_cache->insert_hint.hfid, hfid)))
+    {
+      /* remember the page for the next insert through this scan cache; estimates of another heap file are kept until
+       * they are flushed */
+      RECDES chain_recdes;
+
+      if (spage_get_record (thread_p, pg_watcher->pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &chain_recdes, PEEK) == S_SUCCESS
+	  && chain_recdes.length == sizeof (HEAP_CHAIN))
+	{
+	  HFID_COPY (&scan_cache->insert_hint.hfid, hfid);
+	  pgbuf_get_vpid (pg_watcher->pgptr, &scan_cache->insert_hint.vpid);
+	  COPY_OID (&scan_cache->insert_hint.class_oid, &((HEAP_CHAIN *) chain_recdes.data)->class_oid);
+	  scan_cache->insert_hint.unfill_space = heap_hdr->unfill_space;
+	}
+    }
+
   addr_hdr.pgptr = hdr_page_watcher.pgptr;
   log_skip_logging (thread_p, &addr_hdr);
   pgbuf_ordered_set_dirty_and_free (thread_p, &hdr_page_watcher);
@@ -6651,6 +6940,7 @@ heap_scancache_start_internal (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_ca
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = mvcc_snapshot;
   scan_cache->partition_list = NULL;
+  heap_insert_hint_init (&scan_cache->insert_hint);
 
   return ret;
 
@@ -6670,6 +6960,7 @@ exit_on_error:
   scan_cache->debug_initpattern = 0;
   scan_cache->mvcc_snapshot = NULL;
   scan_cache->partition_list = NULL;
+  heap_insert_hint_init (&scan_cache->insert_hint);
 
   return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 }
@@ -6845,6 +7136,11 @@ heap_scancache_reset_modify (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cach
       return ret;
     }
 
+  if (!HFID_EQ (&scan_cache->insert_hint.hfid, hfid))
+    {
+      heap_insert_hint_flush_estimates (thread_p, &scan_cache->insert_hint);
+    }
+
   if (class_oid != NULL)
     {
       if (!OID_EQ (class_oid, &scan_cache->node.class_oid))
@@ -6969,6 +7265,7 @@ heap_scancache_quick_start_internal (HEAP_SCANCACHE * scan_cache, const HFID * h
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = NULL;
   scan_cache->partition_list = NULL;
+  heap_insert_hint_init (&scan_cache->insert_hint);
 
   return NO_ERROR;
 }
@@ -7011,6 +7308,8 @@ heap_scancache_quick_end (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache)
 	    }
 	}
 
+      heap_insert_hint_flush_estimates (thread_p, &scan_cache->insert_hint);
+
       /* Free memory */
       if (scan_cache->area)
 	{
@@ -9355,13 +9654,16 @@ heap_attrinfo_start (THREAD_ENTRY * thread_p, const OID * class_oid, int request
   attr_info->class_oid = *class_oid;
   attr_info->last_cacheindex = -1;
   attr_info->read_cacheindex = -1;
+  attr_info->prev_read_cacheindex = -1;
 
   attr_info->last_classrepr = NULL;
   attr_info->read_classrepr = NULL;
+  attr_info->prev_read_classrepr = NULL;
 
   OID_SET_NULL (&attr_info->inst_oid);
   attr_info->inst_chn = NULL_CHN;
   attr_info->values = NULL;
+  attr_info->lazy_recdes = NULL;
   attr_info->num_values = -1;	/* initialize attr_info */
 
   /* 
@@ -9777,6 +10079,12 @@ exit_on_error:
  * identifier of the class in attr_info. That is, set each
  * attribute information to point to disk related attribute
  * information for given representation identifier.
+ *
+ * Records of older representations are not rewritten when attributes
+ * are added, so a heap may mix records of the last and of an older
+ * representation. The older representation is therefore kept in
+ * prev_read_classrepr while records of the last one are read, instead
+ * of being returned to and fetched again from the classrepr cache.
  */
 static int
 heap_attrinfo_recache (THREAD_ENTRY * thread_p, REPR_ID reprid, HEAP_CACHE_ATTRINFO * attr_info)
@@ -9798,17 +10106,27 @@ heap_attrinfo_recache (THREAD_ENTRY * thread_p, REPR_ID reprid, HEAP_CACHE_ATTRI
 	}
 
       /* 
-       * Do we need to free the current cached disk representation ?
+       * Keep the current cached disk representation as the previous one
        */
       if (attr_info->read_classrepr != attr_info->last_classrepr)
 	{
-	  heap_classrepr_free_and_init (attr_info->read_classrepr, &attr_info->read_cacheindex);
+	  if (attr_info->prev_read_classrepr != NULL)
+	    {
+	      heap_classrepr_free_and_init (attr_info->prev_read_classrepr, &attr_info->prev_read_cacheindex);
+	    }
+	  attr_info->prev_read_classrepr = attr_info->read_classrepr;
+	  attr_info->prev_read_cacheindex = attr_info->read_cacheindex;
 	}
       attr_info->read_classrepr = NULL;
+      attr_info->read_cacheindex = -1;
     }
 
   if (reprid == NULL_REPRID)
     {
+      if (attr_info->prev_read_classrepr != NULL)
+	{
+	  heap_classrepr_free_and_init (attr_info->prev_read_classrepr, &attr_info->prev_read_cacheindex);
+	}
       return NO_ERROR;
     }
 
@@ -9841,11 +10159,23 @@ heap_attrinfo_recache (THREAD_ENTRY * thread_p, REPR_ID reprid, HEAP_CACHE_ATTRI
 	  value->read_attrepr = NULL;
 	}
     }
-  attr_info->read_classrepr =
-    heap_classrepr_get (thread_p, &attr_info->class_oid, NULL, reprid, &attr_info->read_cacheindex);
-  if (attr_info->read_classrepr == NULL)
+
+  if (attr_info->prev_read_classrepr != NULL && attr_info->prev_read_classrepr->id == reprid)
+    {
+      /* switch back to the previous representation */
+      attr_info->read_classrepr = attr_info->prev_read_classrepr;
+      attr_info->read_cacheindex = attr_info->prev_read_cacheindex;
+      attr_info->prev_read_classrepr = NULL;
+      attr_info->prev_read_cacheindex = -1;
+    }
+  else
     {
-      goto exit_on_error;
+      attr_info->read_classrepr =
+	heap_classrepr_get (thread_p, &attr_info->class_oid, NULL, reprid, &attr_info->read_cacheindex);
+      if (attr_info->read_classrepr == NULL)
+	{
+	  goto exit_on_error;
+	}
     }
 
   if (heap_attrinfo_recache_attrepr (attr_info, false) != NO_ERROR)
@@ -9952,6 +10282,7 @@ heap_attrinfo_clear_dbvalues (HEAP_CACHE_ATTRINFO * attr_info)
     }
   OID_SET_NULL (&attr_info->inst_oid);
   attr_info->inst_chn = NULL_CHN;
+  attr_info->lazy_recdes = NULL;
 
   return ret;
 }
@@ -10348,6 +10679,104 @@ exit_on_error:
 }
 
 
+/*
+ * heap_attrinfo_read_dbvalues_lazy () - Prepare the attribute values of an object for decoding on first access
+ *   return: NO_ERROR
+ *   thread_p(in):
+ *   inst_oid(in): The instance oid
+ *   recdes(in): The instance Record descriptor
+ *   attr_info(in/out): The attribute information structure which describe the
+ *                      desired attributes
+ *
+ * Note: The values are not decoded here; heap_attrinfo_access decodes each one from recdes when it is first
+ *       accessed. This lets a predicate that is rejected by its first terms skip decoding the attributes of the
+ *       other terms. recdes must stay valid until heap_attrinfo_end_lazy_read is called.
+ */
+int
+heap_attrinfo_read_dbvalues_lazy (THREAD_ENTRY * thread_p, const OID * inst_oid, RECDES * recdes,
+				  HEAP_CACHE_ATTRINFO * attr_info)
+{
+  int i;
+  REPR_ID reprid;		/* The disk representation of the object */
+  int ret = NO_ERROR;
+
+  assert (inst_oid != NULL && recdes != NULL && recdes->data != NULL);
+
+  /* check to make sure the attr_info has been used */
+  if (attr_info->num_values == -1)
+    {
+      return NO_ERROR;
+    }
+
+  /* 
+   * Make sure that we have the needed cached representation.
+   */
+
+  reprid = or_rep_id (recdes);
+
+  if (attr_info->read_classrepr == NULL || attr_info->read_classrepr->id != reprid)
+    {
+      /* Get the needed representation */
+      ret = heap_attrinfo_recache (thread_p, reprid, attr_info);
+      if (ret != NO_ERROR)
+	{
+	  return ret;
+	}
+    }
+
+  for (i = 0; i < attr_info->num_values; i++)
+    {
+      attr_info->values[i].state = HEAP_UNREAD_ATTRVALUE;
+    }
+  attr_info->lazy_recdes = recdes;
+
+  attr_info->inst_chn = or_chn (recdes);
+  attr_info->inst_oid = *inst_oid;
+
+  return NO_ERROR;
+}
+
+/*
+ * heap_attrinfo_end_lazy_read () - End a lazy read started by heap_attrinfo_read_dbvalues_lazy
+ *   return: NO_ERROR
+ *   attr_info(in/out): The attribute information structure
+ *   read_all(in): true to decode the values that were not accessed
+ *
+ * Note: Values which are not decoded stay unreadable until the next read of the attribute information.
+ */
+int
+heap_attrinfo_end_lazy_read (HEAP_CACHE_ATTRINFO * attr_info, bool read_all)
+{
+  int i;
+  HEAP_ATTRVALUE *value;
+  int ret = NO_ERROR;
+
+  if (attr_info->lazy_recdes == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  if (read_all)
+    {
+      for (i = 0; i < attr_info->num_values; i++)
+	{
+	  value = &attr_info->values[i];
+	  if (value->state == HEAP_UNREAD_ATTRVALUE)
+	    {
+	      ret = heap_attrvalue_read (attr_info->lazy_recdes, value, attr_info);
+	      if (ret != NO_ERROR)
+		{
+		  break;
+		}
+	    }
+	}
+    }
+
+  attr_info->lazy_recdes = NULL;
+
+  return ret;
+}
+
 /*
  * heap_attrinfo_delete_lob ()
  *   return: NO_ERROR
@@ -10556,7 +10985,8 @@ heap_locate_last_attrepr (ATTR_ID attrid, HEAP_CACHE_ATTRINFO * attr_info)
  *
  * Note: Find DB_VALUE of desired attribute identifier.
  * The dbvalue attributes must have been read by now using the
- * function heap_attrinfo_read_dbvalues ()
+ * function heap_attrinfo_read_dbvalues (), or be part of a lazy read
+ * started by heap_attrinfo_read_dbvalues_lazy ()
  */
 DB_VALUE *
 heap_attrinfo_access (ATTR_ID attrid, HEAP_CACHE_ATTRINFO * attr_info)
@@ -10570,13 +11000,23 @@ heap_attrinfo_access (ATTR_ID attrid, HEAP_CACHE_ATTRINFO * attr_info)
     }
 
   value = heap_attrvalue_locate (attrid, attr_info);
-  if (value == NULL || value->state == HEAP_UNINIT_ATTRVALUE)
+  if (value == NULL || value->state == HEAP_UNINIT_ATTRVALUE
+      || (value->state == HEAP_UNREAD_ATTRVALUE && attr_info->lazy_recdes == NULL))
     {
       er_log_debug (ARG_FILE_LINE, "heap_attrinfo_access: Unknown attrid = %d", attrid);
       er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
       return NULL;
     }
 
+  if (value->state == HEAP_UNREAD_ATTRVALUE)
+    {
+      /* first access during a lazy read; decode it now */
+      if (heap_attrvalue_read (attr_info->lazy_recdes, value, attr_info) != NO_ERROR)
+	{
+	  return NULL;
+	}
+    }
+
   return &value->dbvalue;
 }
 
@@ -11875,6 +12315,7 @@ heap_attrinfo_start_with_index (THREAD_ENTRY * thread_p, OID * class_oid, RECDES
   num_btids = &idx_info->num_btids;
 
   set_attrids = guess_attrids;
+  attr_info->lazy_recdes = NULL;
   attr_info->num_values = -1;	/* initialize attr_info */
 
   classrepr = heap_classrepr_get (thread_p, class_oid, class_recdes, NULL_REPRID, &classrepr_cacheindex);
@@ -11966,8 +12407,10 @@ heap_attrinfo_start_with_index (THREAD_ENTRY * thread_p, OID * class_oid, RECDES
       attr_info->class_oid = *class_oid;
       attr_info->last_cacheindex = classrepr_cacheindex;
       attr_info->read_cacheindex = -1;
+      attr_info->prev_read_cacheindex = -1;
       attr_info->last_classrepr = classrepr;
       attr_info->read_classrepr = NULL;
+      attr_info->prev_read_classrepr = NULL;
       OID_SET_NULL (&attr_info->inst_oid);
       attr_info->inst_chn = NULL_CHN;
       attr_info->num_values = num_found_attrs;
@@ -12110,6 +12553,7 @@ heap_attrinfo_start_with_btid (THREAD_ENTRY * thread_p, OID * class_oid, BTID *
    */
   set_attrids = guess_attrids;
 
+  attr_info->lazy_recdes = NULL;
   attr_info->num_values = -1;	/* initialize attr_info */
 
   /* 
@@ -13755,30 +14199,36 @@ heap_check_all_pages (THREAD_ENTRY * thread_p, HFID * hfid)
 #if defined(SA_MODE)
       if (prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES) > 0)
 	{
+	  HEAP_STATS_BESTSPACE_CACHE *part;
 	  HEAP_STATS_ENTRY *ent;
 	  void *last;
 	  int rc;
 
-	  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
-
-	  last = NULL;
-	  while ((ent = (HEAP_STATS_ENTRY *) mht_get2 (heap_Bestspace->hfid_ht, hfid, &last)) != NULL)
+	  for (i = 0; i < HEAP_STATS_BESTSPACE_PARTITIONS && valid_pg == DISK_VALID; i++)
 	    {
-	      assert_release (!VPID_ISNULL (&ent->best.vpid));
-	      if (!VPID_ISNULL (&ent->best.vpid))
+	      part = &heap_Bestspace[i];
+
+	      rc = pthread_mutex_lock (&part->bestspace_mutex);
+
+	      last = NULL;
+	      while ((ent = (HEAP_STATS_ENTRY *) mht_get2 (part->hfid_ht, hfid, &last)) != NULL)
 		{
-		  valid_pg = file_check_vpid (thread_p, &hfid->vfid, &ent->best.vpid);
-		  if (valid_pg != DISK_VALID)
+		  assert_release (!VPID_ISNULL (&ent->best.vpid));
+		  if (!VPID_ISNULL (&ent->best.vpid))
 		    {
-		      break;
+		      valid_pg = file_check_vpid (thread_p, &hfid->vfid, &ent->best.vpid);
+		      if (valid_pg != DISK_VALID)
+			{
+			  break;
+			}
 		    }
+		  assert_release (ent->best.freespace > 0);
 		}
-	      assert_release (ent->best.freespace > 0);
-	    }
 
-	  assert (mht_count (heap_Bestspace->vpid_ht) == mht_count (heap_Bestspace->hfid_ht));
+	      assert (mht_count (part->vpid_ht) == mht_count (part->hfid_ht));
 
-	  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+	      pthread_mutex_unlock (&part->bestspace_mutex);
+	    }
 	}
 #endif
 
@@ -14876,6 +15326,8 @@ heap_chnguess_finalize (void)
 static int
 heap_stats_bestspace_initialize (void)
 {
+  HEAP_STATS_BESTSPACE_CACHE *part;
+  int i;
   int ret = NO_ERROR;
 
   if (heap_Bestspace != NULL)
@@ -14887,30 +15339,43 @@ heap_stats_bestspace_initialize (void)
 	}
     }
 
-  heap_Bestspace = &heap_Bestspace_cache_area;
+  heap_Bestspace = heap_Bestspace_cache_area;
 
-  pthread_mutex_init (&heap_Bestspace->bestspace_mutex, NULL);
+  for (i = 0; i < HEAP_STATS_BESTSPACE_PARTITIONS; i++)
+    {
+      part = &heap_Bestspace[i];
 
-  heap_Bestspace->num_stats_entries = 0;
+      pthread_mutex_init (&part->bestspace_mutex, NULL);
 
-  heap_Bestspace->hfid_ht =
-    mht_create ("Memory hash HFID to {bestspace}", HEAP_STATS_ENTRY_MHT_EST_SIZE, heap_hash_hfid, heap_compare_hfid);
-  if (heap_Bestspace->hfid_ht == NULL)
-    {
-      goto exit_on_error;
+      part->num_stats_entries = 0;
+      part->hfid_ht = NULL;
+      part->vpid_ht = NULL;
+      part->num_alloc = 0;
+      part->num_free = 0;
+      part->free_list_count = 0;
+      part->free_list = NULL;
     }
 
-  heap_Bestspace->vpid_ht =
-    mht_create ("Memory hash VPID to {bestspace}", HEAP_STATS_ENTRY_MHT_EST_SIZE, heap_hash_vpid, heap_compare_vpid);
-  if (heap_Bestspace->vpid_ht == NULL)
+  for (i = 0; i < HEAP_STATS_BESTSPACE_PARTITIONS; i++)
     {
-      goto exit_on_error;
-    }
+      part = &heap_Bestspace[i];
+
+      part->hfid_ht =
+	mht_create ("Memory hash HFID to {bestspace}", HEAP_STATS_ENTRY_MHT_EST_SIZE / HEAP_STATS_BESTSPACE_PARTITIONS,
+		    heap_hash_hfid, heap_compare_hfid);
+      if (part->hfid_ht == NULL)
+	{
+	  goto exit_on_error;
+	}
 
-  heap_Bestspace->num_alloc = 0;
-  heap_Bestspace->num_free = 0;
-  heap_Bestspace->free_list_count = 0;
-  heap_Bestspace->free_list = NULL;
+      part->vpid_ht =
+	mht_create ("Memory hash VPID to {bestspace}", HEAP_STATS_ENTRY_MHT_EST_SIZE / HEAP_STATS_BESTSPACE_PARTITIONS,
+		    heap_hash_vpid, heap_compare_vpid);
+      if (part->vpid_ht == NULL)
+	{
+	  goto exit_on_error;
+	}
+    }
 
   return ret;
 
@@ -14928,7 +15393,9 @@ exit_on_error:
 static int
 heap_stats_bestspace_finalize (void)
 {
+  HEAP_STATS_BESTSPACE_CACHE *part;
   HEAP_STATS_ENTRY *ent;
+  int i;
   int ret = NO_ERROR;
 
   if (heap_Bestspace == NULL)
@@ -14936,37 +15403,42 @@ heap_stats_bestspace_finalize (void)
       return NO_ERROR;
     }
 
-  if (heap_Bestspace->vpid_ht != NULL)
+  for (i = 0; i < HEAP_STATS_BESTSPACE_PARTITIONS; i++)
     {
-      (void) mht_map_no_key (NULL, heap_Bestspace->vpid_ht, heap_stats_entry_free, NULL);
-      while (heap_Bestspace->free_list_count > 0)
+      part = &heap_Bestspace[i];
+
+      if (part->vpid_ht != NULL)
 	{
-	  ent = heap_Bestspace->free_list;
-	  assert_release (ent != NULL);
+	  (void) mht_map_no_key (NULL, part->vpid_ht, heap_stats_entry_free, part);
+	  while (part->free_list_count > 0)
+	    {
+	      ent = part->free_list;
+	      assert_release (ent != NULL);
 
-	  heap_Bestspace->free_list = ent->next;
-	  ent->next = NULL;
+	      part->free_list = ent->next;
+	      ent->next = NULL;
 
-	  free (ent);
+	      free (ent);
 
-	  heap_Bestspace->free_list_count--;
+	      part->free_list_count--;
+	    }
+	  assert_release (part->free_list == NULL);
 	}
-      assert_release (heap_Bestspace->free_list == NULL);
-    }
 
-  if (heap_Bestspace->vpid_ht != NULL)
-    {
-      mht_destroy (heap_Bestspace->vpid_ht);
-      heap_Bestspace->vpid_ht = NULL;
-    }
+      if (part->vpid_ht != NULL)
+	{
+	  mht_destroy (part->vpid_ht);
+	  part->vpid_ht = NULL;
+	}
 
-  if (heap_Bestspace->hfid_ht != NULL)
-    {
-      mht_destroy (heap_Bestspace->hfid_ht);
-      heap_Bestspace->hfid_ht = NULL;
-    }
+      if (part->hfid_ht != NULL)
+	{
+	  mht_destroy (part->hfid_ht);
+	  part->hfid_ht = NULL;
+	}
 
-  pthread_mutex_destroy (&heap_Bestspace->bestspace_mutex);
+      pthread_mutex_destroy (&part->bestspace_mutex);
+    }
 
   heap_Bestspace = NULL;
 
@@ -16668,7 +17140,7 @@ heap_compact_pages (THREAD_ENTRY * thread_p, OID * class_oid)
     {
       vpid = next_vpid;
       pg_watcher.pgptr =
-	heap_scan_pb_lock_and_fetch (thread_p, &vpid, OLD_PAGE_PREVENT_DEALLOC, X_LOCK, NULL, &pg_watcher);
+	heap_scan_pb_lock_and_fetch (thread_p, &vpid, OLD_PAGE_PREVENT_DEALLOC, S_LOCK, NULL, &pg_watcher);
       if (old_pg_watcher.pgptr != NULL)
 	{
 	  pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
@@ -16686,6 +17158,32 @@ heap_compact_pages (THREAD_ENTRY * thread_p, OID * class_oid)
 	  goto exit_on_error;
 	}
 
+      /* The walk only read-latches pages. A page is compacted only if it is fragmented and the latch can be promoted
+       * without waiting, i.e. nobody else is using the page. Busy pages are left for a later run instead of blocking
+       * concurrent transactions, and pages that are already compact are not dirtied. */
+      if (!spage_is_fragmented (pg_watcher.pgptr))
+	{
+	  pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
+	  continue;
+	}
+
+      ret = pgbuf_promote_read_latch (thread_p, &pg_watcher.pgptr, PGBUF_PROMOTE_ONLY_READER);
+      if (ret == ER_PAGE_LATCH_PROMOTE_FAIL)
+	{
+	  er_clear ();
+	  ret = NO_ERROR;
+	  pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
+	  continue;
+	}
+      else if (ret != NO_ERROR || pg_watcher.pgptr == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (ret);
+	  goto exit_on_error;
+	}
+      /* The watcher must know the page is now write latched; pgbuf_ordered_fix refixes held pages in the latch mode
+       * of their watchers when it has to reorder them. */
+      pg_watcher.latch_mode = PGBUF_LATCH_WRITE;
+
       if (spage_compact (thread_p, pg_watcher.pgptr) != NO_ERROR)
 	{
 	  pgbuf_ordered_unfix (thread_p, &pg_watcher);
@@ -24200,6 +24698,15 @@ heap_get_visible_version_internal (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT * c
       mvcc_snapshot = context->scan_cache->mvcc_snapshot;
     }
 
+  if (mvcc_snapshot != NULL && context->old_chn == NULL_CHN
+      && heap_page_get_vacuum_status (thread_p, context->home_page_watcher.pgptr) == HEAP_PAGE_VACUUM_NONE)
+    {
+      /* Vacuum status is kept on the home page for all record types and no MVCC operation happened on this page since
+       * it was last vacuumed. All its objects are visible to everyone; skip reading the MVCC header (which costs an
+       * overflow page fix for REC_BIGONE) and the snapshot check. */
+      mvcc_snapshot = NULL;
+    }
+
   if (mvcc_snapshot != NULL || context->old_chn != NULL_CHN)
     {
       /* mvcc header is needed for visibility check or chn check */
@@ -24689,7 +25196,14 @@ heap_rv_undo_ovf_update (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 int
 heap_get_best_space_num_stats_entries (void)
 {
-  return heap_Bestspace->num_stats_entries;
+  int i, num_stats_entries = 0;
+
+  for (i = 0; i < HEAP_STATS_BESTSPACE_PARTITIONS; i++)
+    {
+      num_stats_entries += heap_Bestspace[i].num_stats_entries;
+    }
+
+  return num_stats_entries;
 }
 
 /*
@@ -128,6 +128,17 @@ struct heap_scancache_node_list
   HEAP_SCANCACHE_NODE_LIST *next;
 };
 
+typedef struct heap_insert_hint HEAP_INSERT_HINT;
+struct heap_insert_hint
+{				/* Page of the last insert through a scan cache, tried first by the next insert */
+  HFID hfid;			/* Heap file of the page and of the pending estimates */
+  VPID vpid;			/* Page of the last insert or NULL */
+  OID class_oid;		/* Class of the heap pages, used to check the page was not reused */
+  int unfill_space;		/* Unfill space of the heap file */
+  int num_recs;			/* Inserted records not yet added to the heap header estimates */
+  float recs_sumlen;		/* Their total length */
+};
+
 typedef struct heap_scancache HEAP_SCANCACHE;
 struct heap_scancache
 {				/* Define a scan over the whole heap file */
@@ -147,6 +158,7 @@ struct heap_scancache
   MVCC_SNAPSHOT *mvcc_snapshot;	/* mvcc snapshot */
   HEAP_SCANCACHE_NODE_LIST *partition_list;	/* list holding the heap file information for partition nodes involved
 						 * in the scan */
+  HEAP_INSERT_HINT insert_hint;	/* where the last insert found space */
 };
 
 typedef struct heap_scanrange HEAP_SCANRANGE;
@@ -440,6 +452,9 @@ extern int heap_attrinfo_read_dbvalues (THREAD_ENTRY * thread_p, const OID * ins
 					HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info);
 extern int heap_attrinfo_read_dbvalues_without_oid (THREAD_ENTRY * thread_p, RECDES * recdes,
 						    HEAP_CACHE_ATTRINFO * attr_info);
+extern int heap_attrinfo_read_dbvalues_lazy (THREAD_ENTRY * thread_p, const OID * inst_oid, RECDES * recdes,
+					     HEAP_CACHE_ATTRINFO * attr_info);
+extern int heap_attrinfo_end_lazy_read (HEAP_CACHE_ATTRINFO * attr_info, bool read_all);
 extern int heap_attrinfo_delete_lob (THREAD_ENTRY * thread_p, RECDES * recdes, HEAP_CACHE_ATTRINFO * attr_info);
 extern DB_VALUE *heap_attrinfo_access (ATTR_ID attrid, HEAP_CACHE_ATTRINFO * attr_info);
 extern int heap_attrinfo_set (const OID * inst_oid, ATTR_ID attrid, DB_VALUE * attr_val,
@@ -36,6 +36,9 @@
 #include "log_manager.h"
 #include "overflow_file.h"
 #include "heap_file.h"
+#include "object_representation.h"
+#include "system_parameter.h"
+#include "log_compress.h"
 
 #define OVERFLOW_ALLOCVPID_ARRAY_SIZE 64
 
@@ -65,6 +68,87 @@ static const VPID *overflow_traverse (THREAD_ENTRY * thread_p, const VFID * ovf_
 				      OVERFLOW_DO_FUNC func);
 static int overflow_delete_internal (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * vpid, PAGE_PTR pgptr);
 static int overflow_flush_internal (THREAD_ENTRY * thread_p, PAGE_PTR pgptr);
+static char *overflow_compress_record (THREAD_ENTRY * thread_p, const RECDES * recdes, FILE_TYPE file_type,
+				       int *zip_length);
+static SCAN_CODE overflow_copy_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, PAGE_PTR pgptr, char *data,
+				       int start_offset, int max_nbytes);
+static SCAN_CODE overflow_uncompress_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, PAGE_PTR pgptr,
+					     int zip_length, char *data, int start_offset, int max_nbytes);
+#if !defined(NDEBUG)
+static void overflow_check_record (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, const RECDES * recdes,
+				   FILE_TYPE file_type);
+#endif
+
+/*
+ * overflow_compress_record () - Compress a heap record that is going to be stored in overflow pages.
+ *
+ * return          : Buffer with the compressed record or NULL if the record should be stored as it is
+ * thread_p (in)   : Thread entry
+ * recdes (in)     : Record
+ * file_type (in)  : Overflow file type
+ * zip_length (out): Length of compressed record
+ *
+ * Note: Only records of heap overflow files that are at least PRM_ID_HF_OVF_COMPRESS_THRESHOLD bytes long are
+ *       compressed, with the layout described in log_compress.h. The record is stored as it is if compression does
+ *       not reduce its size.
+ */
+static char *
+overflow_compress_record (THREAD_ENTRY * thread_p, const RECDES * recdes, FILE_TYPE file_type, int *zip_length)
+{
+  int threshold = prm_get_integer_value (PRM_ID_HF_OVF_COMPRESS_THRESHOLD);
+  char *zip_data = NULL;
+  LOG_ZIP *zip_undo;
+  lzo_bytep wrkmem = NULL;
+  bool is_wrkmem_allocated = false;
+  bool is_zipped;
+
+  if (file_type != FILE_MULTIPAGE_OBJECT_HEAP || threshold <= 0 || recdes->length < threshold
+      || recdes->length <= LOG_ZIP_RECORD_BODY_OFFSET)
+    {
+      return NULL;
+    }
+
+  /* Borrow the lzo working memory of the thread; the record is compressed before anything is logged. */
+  zip_undo = logpb_get_zip_undo (thread_p);
+  if (zip_undo != NULL && zip_undo->wrkmem != NULL)
+    {
+      wrkmem = zip_undo->wrkmem;
+    }
+  else
+    {
+      /* stand-alone mode without log compression */
+      wrkmem = (lzo_bytep) malloc (LZO1X_1_MEM_COMPRESS);
+      if (wrkmem == NULL)
+	{
+	  /* not an error; store the record uncompressed */
+	  return NULL;
+	}
+      is_wrkmem_allocated = true;
+    }
+
+  zip_data = (char *) malloc (LOG_ZIP_RECORD_BUF_SIZE (recdes->length));
+  if (zip_data == NULL)
+    {
+      /* not an error; store the record uncompressed */
+      is_zipped = false;
+    }
+  else
+    {
+      is_zipped = log_zip_record (recdes->length, recdes->data, zip_data, zip_length, wrkmem);
+    }
+
+  if (is_wrkmem_allocated)
+    {
+      free_and_init (wrkmem);
+    }
+
+  if (!is_zipped && zip_data != NULL)
+    {
+      free_and_init (zip_data);
+    }
+
+  return zip_data;
+}
 
 /*
  * overflow_insert () - Insert an overflow record (multiple-pages size record).
@@ -105,6 +189,11 @@ overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid
   VPID vpids_buffer[OVERFLOW_ALLOCVPID_ARRAY_SIZE + 1];
   bool is_sysop_started = false;
   PAGE_TYPE ptype = PAGE_OVERFLOW;
+  RECDES zip_recdes;
+  char *zip_data;
+#if !defined(NDEBUG)
+  RECDES *user_recdes;
+#endif
 
   int error_code = NO_ERROR;
 
@@ -115,6 +204,16 @@ overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid
 	  || file_type == FILE_BTREE_OVERFLOW_KEY	/* b-tree overflow key */
 	  || file_type == FILE_MULTIPAGE_OBJECT_HEAP /* heap overflow file */ );
 
+#if !defined(NDEBUG)
+  user_recdes = recdes;
+#endif
+  zip_data = overflow_compress_record (thread_p, recdes, file_type, &zip_recdes.length);
+  if (zip_data != NULL)
+    {
+      zip_recdes.data = zip_data;
+      recdes = &zip_recdes;
+    }
+
   addr.vfid = ovf_vfid;
   addr.offset = 0;
 
@@ -138,6 +237,10 @@ overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid
       if (vpids == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (npages + 1) * sizeof (VPID));
+	  if (zip_data != NULL)
+	    {
+	      free_and_init (zip_data);
+	    }
 	  return ER_OUT_OF_VIRTUAL_MEMORY;
 	}
     }
@@ -197,7 +300,7 @@ overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid
 	  first_part = (OVERFLOW_FIRST_PART *) addr.pgptr;
 
 	  first_part->next_vpid = vpids[i + 1];
-	  first_part->length = length;
+	  first_part->length = (zip_data != NULL) ? MAKE_ZIP_LEN (length) : length;
 	  copyto = (char *) first_part->data;
 
 	  copy_length = DB_PAGESIZE - offsetof (OVERFLOW_FIRST_PART, data);
@@ -255,10 +358,18 @@ overflow_insert (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, VPID * ovf_vpid
 
   log_sysop_attach_to_outer (thread_p);
 
+#if !defined(NDEBUG)
+  overflow_check_record (thread_p, ovf_vpid, user_recdes, file_type);
+#endif
+
   if (vpids != vpids_buffer)
     {
       free_and_init (vpids);
     }
+  if (zip_data != NULL)
+    {
+      free_and_init (zip_data);
+    }
   return NO_ERROR;
 
 exit_on_error:
@@ -272,6 +383,10 @@ exit_on_error:
     {
       free_and_init (vpids);
     }
+  if (zip_data != NULL)
+    {
+      free_and_init (zip_data);
+    }
   return error_code;
 }
 
@@ -396,6 +511,11 @@ overflow_update (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, const VPID * ov
   LOG_DATA_ADDR addr;
   bool isnewpage = false;
   PAGE_TYPE ptype = PAGE_OVERFLOW;
+  RECDES zip_recdes;
+  char *zip_data;
+#if !defined(NDEBUG)
+  RECDES *user_recdes;
+#endif
   int error_code = NO_ERROR;
 
   assert (ovf_vfid != NULL && !VFID_ISNULL (ovf_vfid));
@@ -405,6 +525,16 @@ overflow_update (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, const VPID * ov
    */
   assert (file_type == FILE_MULTIPAGE_OBJECT_HEAP);
 
+#if !defined(NDEBUG)
+  user_recdes = recdes;
+#endif
+  zip_data = overflow_compress_record (thread_p, recdes, file_type, &zip_recdes.length);
+  if (zip_data != NULL)
+    {
+      zip_recdes.data = zip_data;
+      recdes = &zip_recdes;
+    }
+
   addr.vfid = ovf_vfid;
   addr.offset = 0;
   next_vpid = *ovf_vpid;
@@ -433,7 +563,7 @@ overflow_update (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, const VPID * ov
 	{
 	  /* This is the first part */
 	  first_part = (OVERFLOW_FIRST_PART *) addr.pgptr;
-	  old_length = first_part->length;
+	  old_length = GET_ZIP_LEN (first_part->length);
 
 	  copyto = (char *) first_part->data;
 	  next_vpid = first_part->next_vpid;
@@ -461,7 +591,7 @@ overflow_update (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, const VPID * ov
 	    }
 
 	  /* Modify the new length */
-	  first_part->length = length;
+	  first_part->length = (zip_data != NULL) ? MAKE_ZIP_LEN (length) : length;
 
 	  /* notify the first part of overflow recdes */
 	  log_append_empty_record (thread_p, LOG_DUMMY_OVF_RECORD, &addr);
@@ -594,12 +724,24 @@ overflow_update (THREAD_ENTRY * thread_p, const VFID * ovf_vfid, const VPID * ov
   /* done */
   log_sysop_attach_to_outer (thread_p);
 
+#if !defined(NDEBUG)
+  overflow_check_record (thread_p, ovf_vpid, user_recdes, file_type);
+#endif
+
+  if (zip_data != NULL)
+    {
+      free_and_init (zip_data);
+    }
   return NO_ERROR;
 
 exit_on_error:
 
   log_sysop_abort (thread_p);
 
+  if (zip_data != NULL)
+    {
+      free_and_init (zip_data);
+    }
   return error_code;
 }
 
@@ -692,6 +834,7 @@ overflow_flush (THREAD_ENTRY * thread_p, const VPID * ovf_vpid)
 int
 overflow_get_length (THREAD_ENTRY * thread_p, const VPID * ovf_vpid)
 {
+  OVERFLOW_FIRST_PART *first_part;
   PAGE_PTR pgptr;
   int length;
 
@@ -709,7 +852,16 @@ overflow_get_length (THREAD_ENTRY * thread_p, const VPID * ovf_vpid)
 
   (void) pgbuf_check_page_ptype (thread_p, pgptr, PAGE_OVERFLOW);
 
-  length = ((OVERFLOW_FIRST_PART *) pgptr)->length;
+  first_part = (OVERFLOW_FIRST_PART *) pgptr;
+  if (ZIP_CHECK (first_part->length))
+    {
+      /* length of uncompressed record */
+      length = log_unzip_record_length (first_part->data);
+    }
+  else
+    {
+      length = first_part->length;
+    }
 
   pgbuf_unfix_and_init (thread_p, pgptr);
 
@@ -733,18 +885,19 @@ overflow_get_length (THREAD_ENTRY * thread_p, const VPID * ovf_vpid)
  *       hint of the number of bytes needed is returned as a negative value in
  *       recdes->length. The length of the retrieved number of bytes is *set
  *       in the the record descriptor (i.e., recdes->length).
+ *
+ *       Offsets and lengths always refer to the uncompressed record. A
+ *       compressed record is uncompressed unless only its MVCC header is read.
  */
 SCAN_CODE
 overflow_get_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, RECDES * recdes, int start_offset, int max_nbytes,
 		     int *remaining_length, MVCC_SNAPSHOT * mvcc_snapshot)
 {
   OVERFLOW_FIRST_PART *first_part;
-  OVERFLOW_REST_PART *rest_parts;
   PAGE_PTR pgptr = NULL;
-  char *copyfrom;
   VPID next_vpid;
-  int copy_length;
-  char *data;
+  int zip_length = 0;
+  SCAN_CODE scan;
 
   /* 
    * We don't need to lock the overflow pages since these pages are not
@@ -776,7 +929,15 @@ overflow_get_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, RECDES * re
 	}
     }
 
-  *remaining_length = first_part->length;
+  if (ZIP_CHECK (first_part->length))
+    {
+      zip_length = GET_ZIP_LEN (first_part->length);
+      *remaining_length = log_unzip_record_length (first_part->data);
+    }
+  else
+    {
+      *remaining_length = first_part->length;
+    }
 
   if (max_nbytes < 0)
     {
@@ -822,8 +983,44 @@ overflow_get_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, RECDES * re
 
   recdes->length = max_nbytes;
 
+  if (zip_length > 0 && start_offset + max_nbytes > LOG_ZIP_RECORD_HEADER_SIZE)
+    {
+      scan = overflow_uncompress_nbytes (thread_p, ovf_vpid, pgptr, zip_length, recdes->data, start_offset,
+					 max_nbytes);
+    }
+  else
+    {
+      scan = overflow_copy_nbytes (thread_p, ovf_vpid, pgptr, recdes->data, start_offset, max_nbytes);
+    }
+
+  if (scan != S_SUCCESS)
+    {
+      recdes->length = 0;
+    }
+  return scan;
+}
+
+/*
+ * overflow_copy_nbytes () - Copy a portion of the stored content of an overflow record
+ *   return: scan status
+ *   ovf_vpid(in): Overflow address
+ *   pgptr(in): Fixed first overflow page; it is unfixed by this function
+ *   data(out): Area where the content is copied
+ *   start_offset(in): Start offset of portion to copy
+ *   max_nbytes(in): Number of bytes to copy
+ */
+static SCAN_CODE
+overflow_copy_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, PAGE_PTR pgptr, char *data, int start_offset,
+		      int max_nbytes)
+{
+  OVERFLOW_FIRST_PART *first_part;
+  OVERFLOW_REST_PART *rest_parts;
+  char *copyfrom;
+  VPID next_vpid;
+  int copy_length;
+
   /* Start copying the object */
-  data = recdes->data;
+  first_part = (OVERFLOW_FIRST_PART *) pgptr;
   copyfrom = (char *) first_part->data;
   next_vpid = first_part->next_vpid;
 
@@ -877,7 +1074,6 @@ overflow_get_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, RECDES * re
 	  pgptr = pgbuf_fix (thread_p, &next_vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
 	  if (pgptr == NULL)
 	    {
-	      recdes->length = 0;
 	      return S_ERROR;
 	    }
 
@@ -892,6 +1088,136 @@ overflow_get_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, RECDES * re
   return S_SUCCESS;
 }
 
+/*
+ * overflow_uncompress_nbytes () - Get a portion of the content of a compressed overflow record
+ *   return: scan status
+ *   ovf_vpid(in): Overflow address
+ *   pgptr(in): Fixed first overflow page; it is unfixed by this function
+ *   zip_length(in): Stored length of the compressed record
+ *   data(out): Area where the uncompressed content is copied
+ *   start_offset(in): Start offset of portion to copy
+ *   max_nbytes(in): Number of bytes to copy
+ */
+static SCAN_CODE
+overflow_uncompress_nbytes (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, PAGE_PTR pgptr, int zip_length,
+			    char *data, int start_offset, int max_nbytes)
+{
+  char *zip_data = NULL;
+  char *unzip_data = NULL;
+  int length;
+  SCAN_CODE scan;
+
+  zip_data = (char *) malloc (zip_length);
+  if (zip_data == NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, pgptr);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) zip_length);
+      return S_ERROR;
+    }
+
+  scan = overflow_copy_nbytes (thread_p, ovf_vpid, pgptr, zip_data, 0, zip_length);
+  if (scan != S_SUCCESS)
+    {
+      goto end;
+    }
+
+  length = log_unzip_record_length (zip_data);
+
+  if (start_offset == 0 && max_nbytes == length)
+    {
+      /* the whole record is requested; uncompress it in place */
+      unzip_data = data;
+    }
+  else
+    {
+      unzip_data = (char *) malloc (length);
+      if (unzip_data == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) length);
+	  scan = S_ERROR;
+	  goto end;
+	}
+    }
+
+  if (!log_unzip_record (zip_length, zip_data, unzip_data))
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZO_DECOMPRESS_FAIL, 0);
+      scan = S_ERROR;
+      goto end;
+    }
+
+  if (unzip_data != data)
+    {
+      memcpy (data, unzip_data + start_offset, max_nbytes);
+    }
+
+end:
+  if (unzip_data != NULL && unzip_data != data)
+    {
+      free_and_init (unzip_data);
+    }
+  free_and_init (zip_data);
+
+  return scan;
+}
+
+#if !defined(NDEBUG)
+/*
+ * overflow_check_record () - Check that a heap record just stored in overflow pages reads back as it was given
+ *   return: void
+ *   ovf_vpid(in): Overflow address
+ *   recdes(in): Record as given to overflow_insert or overflow_update
+ *   file_type(in): Overflow file type
+ *
+ * Note: Only done when heap overflow records may be compressed. The length, the MVCC header alone, a portion in the
+ *       middle and the whole record are read and compared, so both compressed records and records below the
+ *       compression threshold go through overflow_get_length and overflow_get_nbytes.
+ */
+static void
+overflow_check_record (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, const RECDES * recdes, FILE_TYPE file_type)
+{
+  RECDES read_recdes;
+  int remaining_length;
+  int start_offset, nbytes;
+  SCAN_CODE scan;
+
+  if (file_type != FILE_MULTIPAGE_OBJECT_HEAP || prm_get_integer_value (PRM_ID_HF_OVF_COMPRESS_THRESHOLD) <= 0)
+    {
+      return;
+    }
+
+  assert (overflow_get_length (thread_p, ovf_vpid) == recdes->length);
+
+  read_recdes.data = (char *) malloc (recdes->length);
+  if (read_recdes.data == NULL)
+    {
+      return;
+    }
+  read_recdes.area_size = recdes->length;
+
+  /* MVCC header only */
+  nbytes = MIN (LOG_ZIP_RECORD_HEADER_SIZE, recdes->length);
+  scan = overflow_get_nbytes (thread_p, ovf_vpid, &read_recdes, 0, nbytes, &remaining_length, NULL);
+  assert (scan == S_SUCCESS && read_recdes.length == nbytes && remaining_length == recdes->length - nbytes);
+  assert (memcmp (read_recdes.data, recdes->data, nbytes) == 0);
+
+  /* a portion in the middle */
+  start_offset = recdes->length / 3;
+  nbytes = recdes->length / 3;
+  scan = overflow_get_nbytes (thread_p, ovf_vpid, &read_recdes, start_offset, nbytes, &remaining_length, NULL);
+  assert (scan == S_SUCCESS && read_recdes.length == nbytes
+	  && remaining_length == recdes->length - start_offset - nbytes);
+  assert (memcmp (read_recdes.data, recdes->data + start_offset, nbytes) == 0);
+
+  /* whole record */
+  scan = overflow_get_nbytes (thread_p, ovf_vpid, &read_recdes, 0, -1, &remaining_length, NULL);
+  assert (scan == S_SUCCESS && read_recdes.length == recdes->length && remaining_length == 0);
+  assert (memcmp (read_recdes.data, recdes->data, recdes->length) == 0);
+
+  free_and_init (read_recdes.data);
+}
+#endif /* !NDEBUG */
+
 /*
  * overflow_get () - Get the content of a multipage object from overflow
  *   return: scan status
@@ -955,9 +1281,9 @@ overflow_get_capacity (THREAD_ENTRY * thread_p, const VPID * ovf_vpid, int *ovf_
   (void) pgbuf_check_page_ptype (thread_p, pgptr, PAGE_OVERFLOW);
 
   first_part = (OVERFLOW_FIRST_PART *) pgptr;
-  remain_length = first_part->length;
+  remain_length = GET_ZIP_LEN (first_part->length);
 
-  *ovf_size = first_part->length;
+  *ovf_size = remain_length;
   *ovf_num_pages = 0;
   *ovf_overhead = 0;
   *ovf_free_space = 0;
@@ -1052,7 +1378,7 @@ overflow_dump (THREAD_ENTRY * thread_p, FILE * fp, VPID * ovf_vpid)
     }
 
   first_part = (OVERFLOW_FIRST_PART *) pgptr;
-  remain_length = first_part->length;
+  remain_length = GET_ZIP_LEN (first_part->length);
   dumpfrom = (char *) first_part->data;
   next_vpid = first_part->next_vpid;
 
@@ -1187,6 +1187,26 @@ spage_is_slotted_page_type (PAGE_TYPE ptype)
     }
 }
 
+/*
+ * spage_is_fragmented () - Is part of the free space of the page scattered
+ *                          between records?
+ *   return: true if spage_compact would gain contiguous free space
+ *
+ *   page_p(in): Pointer to slotted page
+ */
+bool
+spage_is_fragmented (PAGE_PTR page_p)
+{
+  SPAGE_HEADER *page_header_p;
+
+  assert (page_p != NULL);
+
+  page_header_p = (SPAGE_HEADER *) page_p;
+  SPAGE_VERIFY_HEADER (page_header_p);
+
+  return page_header_p->cont_free < page_header_p->total_free;
+}
+
 /*
  * spage_compact () -  Compact an slotted page
  *   return:
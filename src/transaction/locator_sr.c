@@ -8292,8 +8292,9 @@ locator_update_index (THREAD_ENTRY * thread_p, RECDES * new_recdes, RECDES * old
 	  pk_btid_index = i;
 	}
 
-      /* check for specified update attributes */
-      if ((att_id != NULL) && ((use_mvcc == false) || (index->type == BTREE_PRIMARY_KEY && index->fk != NULL)))
+      /* check for specified update attributes. MVCC updates keep the object in place (same OID), so an index none
+       * of whose key attributes were assigned keeps the same key and needs neither key building nor comparison. */
+      if (att_id != NULL)
 	{
 	  found_btid = false;	/* guess as not found */
 
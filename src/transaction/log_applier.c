@@ -4170,6 +4170,9 @@ la_get_overflow_recdes (LOG_RECORD_HEADER * log_record, void *logs, RECDES * rec
   int area_offset;
   int error = NO_ERROR;
   int length = 0;
+  int first_length = 0;
+  int unzip_length;
+  char *zip_data = NULL;
 
   LSA_COPY (&current_lsa, &log_record->prev_tranlsa);
   prev_vpid.pageid = ((LOG_REC_UNDOREDO *) logs)->data.pageid;
@@ -4267,6 +4270,7 @@ la_get_overflow_recdes (LOG_RECORD_HEADER * log_record, void *logs, RECDES * rec
       if (first)
 	{
 	  area_offset = offsetof (LA_OVF_FIRST_PART, data);
+	  first_length = ((LA_OVF_FIRST_PART *) ovf_list_data->data)->length;
 	  first = false;
 	}
       else
@@ -4283,6 +4287,43 @@ la_get_overflow_recdes (LOG_RECORD_HEADER * log_record, void *logs, RECDES * rec
 
   recdes->length = length;
 
+  if (ZIP_CHECK (first_length))
+    {
+      /* The heap record was compressed by the server (see log_compress.h); give the uncompressed record. The
+       * compressed one is copied aside because la_realloc_recdes_data may free the current area. */
+      length = GET_ZIP_LEN (first_length);
+      if (length > copyed_len || length <= LOG_ZIP_RECORD_BODY_OFFSET)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZO_DECOMPRESS_FAIL, 0);
+	  return ER_IO_LZO_DECOMPRESS_FAIL;
+	}
+
+      zip_data = (char *) malloc (length);
+      if (zip_data == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, length);
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      memcpy (zip_data, recdes->data, length);
+
+      unzip_length = log_unzip_record_length (zip_data);
+      error = la_realloc_recdes_data (recdes, unzip_length);
+      if (error == NO_ERROR)
+	{
+	  if (log_unzip_record (length, zip_data, recdes->data))
+	    {
+	      recdes->length = unzip_length;
+	    }
+	  else
+	    {
+	      error = ER_IO_LZO_DECOMPRESS_FAIL;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+	    }
+	}
+
+      free_and_init (zip_data);
+    }
+
   return error;
 }
 
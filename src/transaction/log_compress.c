@@ -31,6 +31,7 @@
 #include "log_compress.h"
 #include "error_manager.h"
 #include "memory_alloc.h"
+#include "object_representation.h"
 
 /*
  * log_zip - compress(zip) log data into LOG_ZIP
@@ -187,6 +188,101 @@ log_diff (LOG_ZIP_SIZE_T undo_length, const void *undo_data, LOG_ZIP_SIZE_T redo
   return true;
 }
 
+/*
+ * log_zip_record - compress a heap record behind its uncompressed MVCC header
+ *   return: true if the record was compressed, false if it should be stored as it is
+ *   length(in): length of the record
+ *   data(in): record data
+ *   zip_data(out): compressed record; at least LOG_ZIP_RECORD_BUF_SIZE (length) bytes
+ *   zip_length(out): length of the compressed record
+ *   wrkmem(in): working memory for lzo function
+ *
+ * Note: False is also returned when compression does not reduce the size of the record.
+ */
+bool
+log_zip_record (LOG_ZIP_SIZE_T length, const char *data, char *zip_data, LOG_ZIP_SIZE_T * zip_length,
+		lzo_bytep wrkmem)
+{
+  LOG_ZIP_SIZE_T body_length;
+  lzo_uint zip_body_length = 0;
+  int rc;
+
+  assert (data != NULL && zip_data != NULL && zip_length != NULL && wrkmem != NULL);
+
+  if (length <= LOG_ZIP_RECORD_BODY_OFFSET)
+    {
+      return false;
+    }
+
+  body_length = length - LOG_ZIP_RECORD_HEADER_SIZE;
+
+  memcpy (zip_data, data, LOG_ZIP_RECORD_HEADER_SIZE);
+  memcpy (zip_data + LOG_ZIP_RECORD_HEADER_SIZE, &body_length, sizeof (LOG_ZIP_SIZE_T));
+
+  rc = lzo1x_1_compress ((lzo_bytep) data + LOG_ZIP_RECORD_HEADER_SIZE, (lzo_uint) body_length,
+			 (lzo_bytep) zip_data + LOG_ZIP_RECORD_BODY_OFFSET, &zip_body_length, wrkmem);
+  if (rc != LZO_E_OK || LOG_ZIP_RECORD_BODY_OFFSET + (LOG_ZIP_SIZE_T) zip_body_length >= length)
+    {
+      return false;
+    }
+
+  *zip_length = LOG_ZIP_RECORD_BODY_OFFSET + (LOG_ZIP_SIZE_T) zip_body_length;
+  return true;
+}
+
+/*
+ * log_unzip_record_length - get the uncompressed length of a compressed heap record
+ *   return: length of the uncompressed record
+ *   zip_data(in): compressed record; at least LOG_ZIP_RECORD_BODY_OFFSET bytes
+ */
+LOG_ZIP_SIZE_T
+log_unzip_record_length (const char *zip_data)
+{
+  LOG_ZIP_SIZE_T body_length;
+
+  memcpy (&body_length, zip_data + LOG_ZIP_RECORD_HEADER_SIZE, sizeof (LOG_ZIP_SIZE_T));
+
+  return LOG_ZIP_RECORD_HEADER_SIZE + body_length;
+}
+
+/*
+ * log_unzip_record - uncompress a heap record compressed by log_zip_record
+ *   return: true on success, false on failure
+ *   zip_length(in): length of the compressed record
+ *   zip_data(in): compressed record
+ *   data(out): uncompressed record; at least log_unzip_record_length (zip_data) bytes
+ */
+bool
+log_unzip_record (LOG_ZIP_SIZE_T zip_length, const char *zip_data, char *data)
+{
+  LOG_ZIP_SIZE_T body_length;
+  lzo_uint unzip_length;
+  int rc;
+
+  assert (zip_data != NULL && data != NULL);
+
+  if (zip_length <= LOG_ZIP_RECORD_BODY_OFFSET)
+    {
+      return false;
+    }
+
+  body_length = log_unzip_record_length (zip_data) - LOG_ZIP_RECORD_HEADER_SIZE;
+  if (body_length <= 0)
+    {
+      return false;
+    }
+
+  memcpy (data, zip_data, LOG_ZIP_RECORD_HEADER_SIZE);
+
+  unzip_length = (lzo_uint) body_length;
+  rc = lzo1x_decompress_safe ((lzo_bytep) zip_data + LOG_ZIP_RECORD_BODY_OFFSET,
+			      (lzo_uint) (zip_length - LOG_ZIP_RECORD_BODY_OFFSET),
+			      (lzo_bytep) data + LOG_ZIP_RECORD_HEADER_SIZE, &unzip_length, NULL);
+
+  /* if the uncompressed data length != original length, then it means that uncompression failed */
+  return (rc == LZO_E_OK && unzip_length == (lzo_uint) body_length);
+}
+
 /*
  * log_zip_alloc - allocate LOG_ZIP structure
  *   return: LOG_ZIP structure or NULL if error
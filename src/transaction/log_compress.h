@@ -60,6 +60,21 @@ struct log_zip
   lzo_bytep wrkmem;		/* wokring memory for lzo function */
 };
 
+/*
+ * Compressed heap record stored in overflow pages. The MVCC header is kept uncompressed in front of the compressed
+ * body, so that it can still be read and changed in place:
+ *
+ *   | MVCC header (OR_MVCC_MAX_HEADER_SIZE) | length of uncompressed body | compressed body |
+ *
+ * The length on the first overflow page is flagged with MAKE_ZIP_LEN.
+ */
+#define LOG_ZIP_RECORD_HEADER_SIZE OR_MVCC_MAX_HEADER_SIZE
+#define LOG_ZIP_RECORD_BODY_OFFSET (LOG_ZIP_RECORD_HEADER_SIZE + (int) sizeof (LOG_ZIP_SIZE_T))
+
+/* buffer size needed to compress a record of the given length */
+#define LOG_ZIP_RECORD_BUF_SIZE(length) \
+        (LOG_ZIP_RECORD_HEADER_SIZE + LOG_ZIP_BUF_SIZE ((length) - LOG_ZIP_RECORD_HEADER_SIZE))
+
 extern LOG_ZIP *log_zip_alloc (LOG_ZIP_SIZE_T size, bool is_zip);
 extern void log_zip_free (LOG_ZIP * log_zip);
 
@@ -67,4 +82,9 @@ extern bool log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data)
 extern bool log_unzip (LOG_ZIP * log_unzip, LOG_ZIP_SIZE_T length, void *data);
 extern bool log_diff (LOG_ZIP_SIZE_T undo_length, const void *undo_data, LOG_ZIP_SIZE_T redo_length, void *redo_data);
 
+extern bool log_zip_record (LOG_ZIP_SIZE_T length, const char *data, char *zip_data, LOG_ZIP_SIZE_T * zip_length,
+			    lzo_bytep wrkmem);
+extern LOG_ZIP_SIZE_T log_unzip_record_length (const char *zip_data);
+extern bool log_unzip_record (LOG_ZIP_SIZE_T zip_length, const char *zip_data, char *data);
+
 #endif /* _LOG_COMPRESS_H_ */
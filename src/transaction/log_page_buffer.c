@@ -362,7 +362,6 @@ static void logpb_write_toflush_pages_to_archive (THREAD_ENTRY * thread_p);
 static int logpb_add_archive_page_info (THREAD_ENTRY * thread_p, int arv_num, LOG_PAGEID start_page,
 					LOG_PAGEID end_page);
 static int logpb_get_archive_num_from_info_table (THREAD_ENTRY * thread_p, LOG_PAGEID page_id);
-static LOG_ZIP *logpb_get_zip_undo (THREAD_ENTRY * thread_p);
 static LOG_ZIP *logpb_get_zip_redo (THREAD_ENTRY * thread_p);
 static char *logpb_get_data_ptr (THREAD_ENTRY * thread_p);
 static bool logpb_realloc_data_ptr (THREAD_ENTRY * thread_p, int length);
@@ -11692,7 +11691,16 @@ logpb_realloc_data_ptr (THREAD_ENTRY * thread_p, int length)
 #endif
 }
 
-static LOG_ZIP *
+/*
+ * logpb_get_zip_undo - get the undo LOG_ZIP of the thread
+ *
+ * return: LOG_ZIP structure or NULL if not available
+ *
+ *   thread_p(in):
+ *
+ * NOTE: Besides logging, its lzo working memory may be borrowed to compress data that is logged afterwards.
+ */
+LOG_ZIP *
 logpb_get_zip_undo (THREAD_ENTRY * thread_p)
 {
 #if defined (SERVER_MODE)